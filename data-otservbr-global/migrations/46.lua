@@ -1,3 +1,26 @@
 function onUpdateDatabase()
-	return false -- true = There are others migrations file | false = this is the last migration file
+	logger.info("Updating database to version 47 (feat: market statistics summary)")
+
+	db.query([[
+		CREATE TABLE IF NOT EXISTS `market_statistics` (
+			`itemtype` int(10) UNSIGNED NOT NULL,
+			`tier` tinyint UNSIGNED NOT NULL DEFAULT '0',
+			`sale` tinyint(1) NOT NULL DEFAULT '0',
+			`transactions` int(10) UNSIGNED NOT NULL DEFAULT '0',
+			`lowest_price` bigint(20) UNSIGNED NOT NULL DEFAULT '0',
+			`highest_price` bigint(20) UNSIGNED NOT NULL DEFAULT '0',
+			`total_price` bigint(20) UNSIGNED NOT NULL DEFAULT '0',
+			CONSTRAINT `market_statistics_pk` PRIMARY KEY (`itemtype`, `tier`, `sale`)
+		) ENGINE=InnoDB DEFAULT CHARSET=utf8;
+	]])
+
+	-- Seed the running aggregates with the accepted offers still in the history
+	db.query([[
+		INSERT INTO `market_statistics` (`itemtype`, `tier`, `sale`, `transactions`, `lowest_price`, `highest_price`, `total_price`)
+		SELECT `itemtype`, `tier`, `sale`, COUNT(`price`), MIN(`price`), MAX(`price`), SUM(`price`)
+		FROM `market_history` WHERE `state` = 3
+		GROUP BY `itemtype`, `tier`, `sale`;
+	]])
+
+	return true
 end
@@ -6,14 +6,20 @@ function MonsterType:generateLootRoll(config, resultTable)
 		return resultTable or {}
 	end
 
-	local monsterLoot = self:getLoot() or {}
 	local factor = config.factor or 1.0
-	local uniqueItems = {}
-
 	if self:isRewardBoss() then
 		factor = factor * SCHEDULE_BOSS_LOOT_RATE / 100
 	end
 
+	-- Without a filter the compiled loot table rolls the same rules natively
+	if not config.filter then
+		local multiplier = configManager.getNumber(configKeys.RATE_LOOT) * SCHEDULE_LOOT_RATE * factor
+		return self:rollLoot(multiplier, config.gut and GLOBAL_CHARM_GUT or 0, resultTable)
+	end
+
+	local monsterLoot = self:getLoot() or {}
+	local uniqueItems = {}
+
 	local result = resultTable or {}
 	for _, item in ipairs(monsterLoot) do
 		local iType = ItemType(item.itemId)
@@ -0,0 +1,34 @@
+local luaProfiler = TalkAction("/luaprofiler")
+
+function luaProfiler.onSay(player, words, param)
+	-- create log
+	logCommand(player, words, param)
+
+	local split = param:split(" ")
+	local action = split[1] and split[1]:lower() or ""
+	if action == "start" then
+		metrics.startLuaProfiler()
+		player:sendTextMessage(MESSAGE_ADMINISTRATOR, "Lua profiler started.")
+	elseif action == "stop" then
+		metrics.stopLuaProfiler()
+		player:sendTextMessage(MESSAGE_ADMINISTRATOR, "Lua profiler stopped.")
+	elseif action == "reset" then
+		metrics.resetLuaProfiler()
+		player:sendTextMessage(MESSAGE_ADMINISTRATOR, "Lua profiler stats cleared.")
+	elseif action == "report" then
+		local report = metrics.getLuaProfilerReport(tonumber(split[2]) or 10)
+		logger.info(report)
+		player:showTextDialog(2019, report)
+	elseif action == "dump" then
+		local file = metrics.dumpLuaProfiler()
+		player:sendTextMessage(MESSAGE_ADMINISTRATOR, string.format("Lua profiler folded stacks written to %s.", file))
+	else
+		local state = metrics.isLuaProfilerRunning() and "running" or "stopped"
+		player:sendTextMessage(MESSAGE_ADMINISTRATOR, string.format("Lua profiler is %s. Usage: %s start|stop|reset|report [lines]|dump", state, words))
+	end
+	return true
+end
+
+luaProfiler:separator(" ")
+luaProfiler:groupType("god")
+luaProfiler:register()
@@ -0,0 +1,21 @@
+local tickProfile = TalkAction("/tickprofile")
+
+function tickProfile.onSay(player, words, param)
+	-- create log
+	logCommand(player, words, param)
+
+	if param:lower() == "reset" then
+		metrics.resetDispatcherProfiler()
+		player:sendTextMessage(MESSAGE_ADMINISTRATOR, "Dispatcher profiler stats cleared.")
+		return true
+	end
+
+	local report = metrics.getDispatcherReport(tonumber(param) or 10)
+	logger.info(report)
+	player:showTextDialog(2019, report)
+	return true
+end
+
+tickProfile:separator(" ")
+tickProfile:groupType("god")
+tickProfile:register()
@@ -78,6 +78,8 @@ int CanaryServer::run() {
 				loadModules();
 				setWorldType();
 				loadMaps();
+				IOMarket::getInstance().loadOffers();
+				IOMarket::getInstance().loadStatistics();
 
 				logger.info("Initializing gamestate...");
 				g_game().setGameState(GAME_STATE_INIT);
@@ -86,7 +88,6 @@ int CanaryServer::run() {
 				g_game().transferHouseItemsToDepot();
 
 				IOMarket::checkExpiredOffers();
-				IOMarket::getInstance().updateStatistics();
 
 				logger.info("Loaded all modules, server starting up...");
 
@@ -341,37 +342,32 @@ void CanaryServer::loadModules() {
 		g_luaEnvironment().initState();
 	}
 
-	auto coreFolder = g_configManager().getString(CORE_DIRECTORY, __FUNCTION__);
-	// Load appearances.dat first
-	modulesLoadHelper((g_game().loadAppearanceProtobuf(coreFolder + "/items/appearances.dat") == ERROR_NONE), "appearances.dat");
-
-	// Load XML folder dependencies (order matters)
-	modulesLoadHelper(g_vocations().loadFromXml(), "XML/vocations.xml");
-	modulesLoadHelper(g_eventsScheduler().loadScheduleEventFromXml(), "XML/events.xml");
-	modulesLoadHelper(Outfits::getInstance().loadFromXml(), "XML/outfits.xml");
-	modulesLoadHelper(Familiars::getInstance().loadFromXml(), "XML/familiars.xml");
-	modulesLoadHelper(g_imbuements().loadFromXml(), "XML/imbuements.xml");
-	modulesLoadHelper(g_storages().loadFromXML(), "XML/storages.xml");
-
-	modulesLoadHelper(Item::items.loadFromXml(), "items.xml");
-
+	const auto coreFolder = g_configManager().getString(CORE_DIRECTORY, __FUNCTION__);
 	const auto datapackFolder = g_configManager().getString(DATA_DIRECTORY, __FUNCTION__);
-	logger.debug("Loading core scripts on folder: {}/", coreFolder);
-	// Load first core Lua libs
-	modulesLoadHelper((g_luaEnvironment().loadFile(coreFolder + "/core.lua", "core.lua") == 0), "core.lua");
-	modulesLoadHelper(g_scripts().loadScripts(coreFolder + "/scripts/lib", true, false), coreFolder + "/scripts/libs");
-	modulesLoadHelper(g_scripts().loadScripts(coreFolder + "/scripts", false, false), coreFolder + "/scripts");
-	modulesLoadHelper((g_npcs().load(true, false)), "npclib");
-
-	modulesLoadHelper(g_events().loadFromXml(), "events/events.xml");
-	modulesLoadHelper(g_modules().loadFromXml(), "modules/modules.xml");
-
-	logger.debug("Loading datapack scripts on folder: {}/", datapackName);
-	// Load scripts
-	modulesLoadHelper(g_scripts().loadScripts(datapackFolder + "/scripts", false, false), datapackFolder + "/scripts");
-	// Load monsters
-	modulesLoadHelper(g_scripts().loadScripts(datapackFolder + "/monster", false, false), datapackFolder + "/monster");
-	modulesLoadHelper((g_npcs().load(false, true)), "npc");
+	const std::vector<std::string> catalogs = { "XML/vocations.xml", "XML/outfits.xml", "XML/familiars.xml", "XML/imbuements.xml", "XML/storages.xml", "items.xml" };
+
+	// Catalogs only fill their own containers and run on the thread pool, items.xml and outfits need appearances.dat.
+	// Every Lua stage runs here, in order, and the scripts may use any catalog.
+	runLoadStages({
+		{ "appearances.dat", [&coreFolder] { return g_game().loadAppearanceProtobuf(coreFolder + "/items/appearances.dat") == ERROR_NONE; } },
+		{ "XML/vocations.xml", [] { return g_vocations().loadFromXml(); } },
+		{ "XML/outfits.xml", [] { return Outfits::getInstance().loadFromXml(); }, { "appearances.dat" } },
+		{ "XML/familiars.xml", [] { return Familiars::getInstance().loadFromXml(); } },
+		{ "XML/imbuements.xml", [] { return g_imbuements().loadFromXml(); } },
+		{ "XML/storages.xml", [] { return g_storages().loadFromXML(); } },
+		{ "items.xml", [] { return Item::items.loadFromXml(); }, { "appearances.dat" } },
+
+		{ "XML/events.xml", [] { return g_eventsScheduler().loadScheduleEventFromXml(); }, { "XML/vocations.xml" }, true },
+		{ "core.lua", [&coreFolder] { return g_luaEnvironment().loadFile(coreFolder + "/core.lua", "core.lua") == 0; }, catalogs, true },
+		{ coreFolder + "/scripts/libs", [&coreFolder] { return g_scripts().loadScripts(coreFolder + "/scripts/lib", true, false); }, {}, true },
+		{ coreFolder + "/scripts", [&coreFolder] { return g_scripts().loadScripts(coreFolder + "/scripts", false, false); }, {}, true },
+		{ "npclib", [] { return g_npcs().load(true, false); }, {}, true },
+		{ "events/events.xml", [] { return g_events().loadFromXml(); }, {}, true },
+		{ "modules/modules.xml", [] { return g_modules().loadFromXml(); }, {}, true },
+		{ datapackFolder + "/scripts", [&datapackFolder] { return g_scripts().loadScripts(datapackFolder + "/scripts", false, false); }, {}, true },
+		{ datapackFolder + "/monster", [&datapackFolder] { return g_scripts().loadScripts(datapackFolder + "/monster", false, false); }, {}, true },
+		{ "npc", [] { return g_npcs().load(false, true); }, {}, true },
+	});
 
 	g_game().loadBoostedCreature();
 	g_ioBosstiary().loadBoostedBoss();
@@ -386,6 +382,116 @@ void CanaryServer::modulesLoadHelper(bool loaded, std::string moduleName) {
 	}
 }
 
+void CanaryServer::runLoadStages(const std::vector<LoadStage> &stages) {
+	enum class StageState : uint8_t {
+		LOADED,
+		FAILED,
+		SKIPPED
+	};
+
+	struct StageTiming {
+		int64_t startedAt = 0;
+		int64_t finishedAt = 0;
+	};
+
+	const auto bootStart = std::chrono::steady_clock::now();
+	const auto elapsedMs = [&bootStart] {
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bootStart).count();
+	};
+
+	// Stages on the loading thread also depend on the previous one there, a failure stops the rest
+	phmap::flat_hash_map<std::string, size_t> stageIndex;
+	std::vector<std::vector<size_t>> dependencies(stages.size());
+	std::optional<size_t> lastLoaderStage;
+	for (size_t i = 0; i < stages.size(); ++i) {
+		if (stages[i].onLoaderThread) {
+			if (lastLoaderStage) {
+				dependencies[i].emplace_back(*lastLoaderStage);
+			}
+			lastLoaderStage = i;
+		}
+
+		for (const auto &dependency : stages[i].dependencies) {
+			const auto it = stageIndex.find(dependency);
+			if (it == stageIndex.end()) {
+				throw FailedToInitializeCanary(fmt::format("Load stage '{}' depends on '{}', which is not listed before it", stages[i].name, dependency));
+			}
+			dependencies[i].emplace_back(it->second);
+		}
+		stageIndex.emplace(stages[i].name, i);
+	}
+
+	// Every stage writes only its own slot, the futures publish them
+	std::vector<StageTiming> timings(stages.size());
+	std::vector<std::shared_future<StageState>> results(stages.size());
+	const auto runStage = [&](size_t i) {
+		// Thread pool tasks are started in submission order, so dependencies are already running or done here
+		for (const size_t dependency : dependencies[i]) {
+			if (results[dependency].get() != StageState::LOADED) {
+				return StageState::SKIPPED;
+			}
+		}
+
+		logger.debug("Loading {}", stages[i].name);
+		timings[i].startedAt = elapsedMs();
+		const bool loaded = stages[i].load();
+		timings[i].finishedAt = elapsedMs();
+		return loaded ? StageState::LOADED : StageState::FAILED;
+	};
+
+	auto &threadPool = inject<ThreadPool>();
+	for (size_t i = 0; i < stages.size(); ++i) {
+		if (!stages[i].onLoaderThread) {
+			results[i] = threadPool.submit_task([&runStage, i] { return runStage(i); }).share();
+			continue;
+		}
+
+		std::promise<StageState> result;
+		try {
+			result.set_value(runStage(i));
+		} catch (...) {
+			result.set_exception(std::current_exception());
+		}
+		results[i] = result.get_future().share();
+	}
+
+	// Pool tasks reference this frame, wait for all of them before reporting anything
+	for (const auto &result : results) {
+		result.wait();
+	}
+
+	// Critical path: the chain of dependencies with the longest total load time
+	std::vector<int64_t> pathLength(stages.size());
+	std::vector<size_t> pathPrevious(stages.size(), stages.size());
+	for (size_t i = 0; i < stages.size(); ++i) {
+		for (const size_t dependency : dependencies[i]) {
+			if (pathLength[dependency] > pathLength[i]) {
+				pathLength[i] = pathLength[dependency];
+				pathPrevious[i] = dependency;
+			}
+		}
+		pathLength[i] += timings[i].finishedAt - timings[i].startedAt;
+	}
+
+	for (size_t i = 0; i < stages.size(); ++i) {
+		const auto state = results[i].get();
+		if (state == StageState::FAILED) {
+			throw FailedToInitializeCanary(fmt::format("Cannot load: {}", stages[i].name));
+		}
+		if (state == StageState::LOADED) {
+			logger.info("Loaded {} in {} ms (started at +{} ms)", stages[i].name, timings[i].finishedAt - timings[i].startedAt, timings[i].startedAt);
+		}
+	}
+
+	const auto pathEnd = std::distance(pathLength.begin(), std::ranges::max_element(pathLength));
+	std::vector<std::string_view> criticalPath;
+	for (auto i = static_cast<size_t>(pathEnd); i != stages.size(); i = pathPrevious[i]) {
+		criticalPath.emplace_back(stages[i].name);
+	}
+	std::ranges::reverse(criticalPath);
+	logger.info("Loaded modules in {} ms, critical path ({} ms): {}", elapsedMs(), pathLength[pathEnd], fmt::join(criticalPath, " -> "));
+}
+
 void CanaryServer::shutdown() {
 	g_dispatcher().shutdown();
 	g_metrics().shutdown();
@@ -52,6 +52,15 @@ private:
 
 	std::atomic<LoaderStatus> loaderStatus = LoaderStatus::LOADING;
 
+	struct LoadStage {
+		std::string name;
+		std::function<bool()> load;
+		// Names of stages that must finish first, they must be listed before this one
+		std::vector<std::string> dependencies {};
+		// Lua stages share one state, so they run on the loading thread in the order given
+		bool onLoaderThread = false;
+	};
+
 	void logInfos();
 	static void toggleForceCloseButton();
 	static void badAllocationHandler();
@@ -67,4 +76,5 @@ private:
 	void loadMaps() const;
 	void setupHousesRent();
 	void modulesLoadHelper(bool loaded, std::string moduleName);
+	void runLoadStages(const std::vector<LoadStage> &stages);
 };
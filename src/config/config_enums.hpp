@@ -60,6 +60,7 @@ enum ConfigKey_t : uint16_t {
 	DISCORD_SEND_FOOTER,
 	DISCORD_WEBHOOK_DELAY_MS,
 	DISCORD_WEBHOOK_URL,
+	DISPATCHER_CYCLE_BUDGET,
 	EMOTE_SPELLS,
 	ENABLE_PLAYER_PUT_ITEM_IN_AMMO_SLOT,
 	ENABLE_SUPPORT_OUTFIT,
@@ -121,8 +122,11 @@ enum ConfigKey_t : uint16_t {
 	INVENTORY_GLOW,
 	IP,
 	KICK_AFTER_MINUTES,
+	KV_FLUSH_INTERVAL,
 	LOCATION,
 	LOGIN_PORT,
+	LOGIN_QUEUE_MAX_DEPTH,
+	LOGIN_WORKER_THREADS,
 	LOGLEVEL,
 	LOOTPOUCH_MAXLIMIT,
 	LOW_LEVEL_BONUS_EXP,
@@ -131,6 +135,8 @@ enum ConfigKey_t : uint16_t {
 	LOYALTY_POINTS_PER_CREATION_DAY,
 	LOYALTY_POINTS_PER_PREMIUM_DAY_PURCHASED,
 	LOYALTY_POINTS_PER_PREMIUM_DAY_SPENT,
+	LUA_PROFILER_DUMP_INTERVAL,
+	LUA_PROFILER_ENABLED,
 	M_CONST,
 	MAINTAIN_MODE_MESSAGE,
 	MAP_AUTHOR,
@@ -20,6 +20,7 @@
 #include "creatures/monsters/monsters.hpp"
 #include "items/weapons/weapons.hpp"
 #include "map/spectators.hpp"
+#include "map/utils/sightline.hpp"
 #include "lib/metrics/metrics.hpp"
 #include "lua/callbacks/event_callback.hpp"
 #include "lua/callbacks/events_callbacks.hpp"
@@ -108,15 +109,17 @@ CombatDamage Combat::getCombatDamage(std::shared_ptr<Creature> creature, std::sh
 	return damage;
 }
 
-void Combat::getCombatArea(const Position &centerPos, const Position &targetPos, const std::unique_ptr<AreaCombat> &area, std::vector<std::shared_ptr<Tile>> &list) {
+void Combat::getCombatArea(const Position &centerPos, const Position &targetPos, const std::unique_ptr<AreaCombat> &area, std::vector<std::shared_ptr<Tile>> &list, std::vector<Position>* missingList /* = nullptr*/) {
 	if (targetPos.z >= MAP_MAX_LAYERS) {
 		return;
 	}
 
 	if (area) {
-		area->getList(centerPos, targetPos, list);
-	} else {
-		list.emplace_back(g_game().map.getOrCreateTile(targetPos));
+		area->getList(centerPos, targetPos, list, missingList);
+	} else if (const auto &tile = g_game().map.getTile(targetPos)) {
+		list.emplace_back(tile);
+	} else if (missingList) {
+		missingList->emplace_back(targetPos);
 	}
 }
 
@@ -1121,29 +1124,36 @@ bool Combat::doCombat(std::shared_ptr<Creature> caster, const Position &position
 
 void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin, const Position &pos, const std::unique_ptr<AreaCombat> &area, const CombatParams &params, CombatFunction func, CombatDamage* data) {
 	std::vector<std::shared_ptr<Tile>> tileList;
+	std::vector<Position> missingList;
 
 	if (caster) {
-		getCombatArea(caster->getPosition(), pos, area, tileList);
+		getCombatArea(caster->getPosition(), pos, area, tileList, &missingList);
 	} else {
-		getCombatArea(pos, pos, area, tileList);
+		getCombatArea(pos, pos, area, tileList, &missingList);
+	}
+
+	// Fields and tile callbacks still need a tile to work on, create the missing ones only for them
+	if (params.itemId != 0 || params.tileCallback) {
+		for (const Position &missingPos : missingList) {
+			tileList.emplace_back(g_game().map.getOrCreateTile(missingPos));
+		}
+		missingList.clear();
 	}
 
 	uint32_t maxX = 0;
 	uint32_t maxY = 0;
 
+	const auto updateRange = [&pos, &maxX, &maxY](const Position &cellPos) {
+		maxX = std::max<uint32_t>(maxX, Position::getDistanceX(cellPos, pos));
+		maxY = std::max<uint32_t>(maxY, Position::getDistanceY(cellPos, pos));
+	};
+
 	// calculate the max viewable range
 	for (const std::shared_ptr<Tile> &tile : tileList) {
-		const Position &tilePos = tile->getPosition();
-
-		uint32_t diff = Position::getDistanceX(tilePos, pos);
-		if (diff > maxX) {
-			maxX = diff;
-		}
-
-		diff = Position::getDistanceY(tilePos, pos);
-		if (diff > maxY) {
-			maxY = diff;
-		}
+		updateRange(tile->getPosition());
+	}
+	for (const Position &missingPos : missingList) {
+		updateRange(missingPos);
 	}
 
 	const int32_t rangeX = maxX + MAP_MAX_VIEW_PORT_X;
@@ -1242,6 +1252,23 @@ void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin
 		combatTileEffects(spectators.data(), caster, tile, params);
 	}
 
+	// Remaining cells without a tile have nothing to hit or place, they only get the impact effect and sound
+	for (const Position &missingPos : missingList) {
+		if (caster && caster->getPosition().z != missingPos.z) {
+			continue;
+		}
+
+		if (params.impactEffect != CONST_ME_NONE) {
+			Game::addMagicEffect(spectators.data(), missingPos, params.impactEffect);
+		}
+
+		if (params.soundImpactEffect != SoundEffect_t::SILENCE) {
+			g_game().sendDoubleSoundEffect(missingPos, params.soundCastEffect, params.soundImpactEffect, caster);
+		} else if (params.soundCastEffect != SoundEffect_t::SILENCE) {
+			g_game().sendSingleSoundEffect(missingPos, params.soundCastEffect, caster);
+		}
+	}
+
 	// Wheel of destiny update beam mastery damage
 	if (casterPlayer) {
 		casterPlayer->wheel()->updateBeamMasteryDamage(tmpDamage, beamAffectedTotal, beamAffectedCurrent);
@@ -1817,6 +1844,7 @@ bool ChainPickerCallback::onChainCombat(std::shared_ptr<Creature> creature, std:
 
 void AreaCombat::clear() {
 	std::ranges::fill(areas, nullptr);
+	std::ranges::fill(footprints, Footprint {});
 }
 
 AreaCombat::AreaCombat(const AreaCombat &rhs) {
@@ -1826,31 +1854,95 @@ AreaCombat::AreaCombat(const AreaCombat &rhs) {
 			areas[i] = area->clone();
 		}
 	}
+	footprints = rhs.footprints;
 }
 
-void AreaCombat::getList(const Position &centerPos, const Position &targetPos, std::vector<std::shared_ptr<Tile>> &list) const {
-	const std::unique_ptr<MatrixArea> &area = getArea(centerPos, targetPos);
-	if (!area) {
+void AreaCombat::getList(const Position &centerPos, const Position &targetPos, std::vector<std::shared_ptr<Tile>> &list, std::vector<Position>* missingList /* = nullptr*/) const {
+	const Footprint &footprint = footprints[getDirection(centerPos, targetPos)];
+	if (footprint.offsets.empty()) {
 		return;
 	}
 
-	uint32_t centerY;
-	uint32_t centerX;
-	area->getCenter(centerY, centerX);
+	// Projectile-blocking state of the bounding box is read once per cell, on first use,
+	// and shared by every sight line crossing it
+	enum : uint8_t {
+		CELL_UNKNOWN,
+		CELL_CLEAR,
+		CELL_BLOCKED,
+	};
+
+	std::vector<uint8_t> cells(static_cast<size_t>(footprint.width) * footprint.height, CELL_UNKNOWN);
+
+	Map &map = g_game().map;
+	const int32_t originX = targetPos.x + footprint.minX;
+	const int32_t originY = targetPos.y + footprint.minY;
+	const auto isBlocked = [&](uint16_t x, uint16_t y) {
+		uint8_t &cell = cells[static_cast<size_t>(x - originX) + static_cast<size_t>(y - originY) * footprint.width];
+		if (cell == CELL_UNKNOWN) {
+			cell = map.isProjectileBlocked(x, y, targetPos.z) ? CELL_BLOCKED : CELL_CLEAR;
+		}
+		return cell == CELL_BLOCKED;
+	};
+
+	list.reserve(list.size() + footprint.offsets.size());
+	for (const auto &[offsetX, offsetY] : footprint.offsets) {
+		const int32_t x = targetPos.x + offsetX;
+		const int32_t y = targetPos.y + offsetY;
+		if (x < 0 || y < 0 || x > std::numeric_limits<uint16_t>::max() || y > std::numeric_limits<uint16_t>::max()) {
+			continue;
+		}
+
+		// Same result as Game::isSightClear(targetPos, cellPos, true), the floor never changes here
+		const Position cellPos(x, y, targetPos.z);
+		if (!Position::areInRange<1, 1>(targetPos, cellPos) && !walkSightLine(targetPos, cellPos, isBlocked)) {
+			continue;
+		}
 
-	const uint32_t rows = area->getRows();
-	const uint32_t cols = area->getCols();
-	list.reserve(rows * cols);
+		if (const auto &tile = map.getTile(cellPos)) {
+			list.emplace_back(tile);
+		} else if (missingList) {
+			missingList->emplace_back(cellPos);
+		}
+	}
+}
 
-	Position tmpPos(targetPos.x - centerX, targetPos.y - centerY, targetPos.z);
-	for (uint32_t y = 0; y < rows; ++y, ++tmpPos.y, tmpPos.x -= cols) {
-		for (uint32_t x = 0; x < cols; ++x, ++tmpPos.x) {
-			if (area->getValue(y, x) != 0) {
-				if (g_game().isSightClear(targetPos, tmpPos, true)) {
-					list.emplace_back(g_game().map.getOrCreateTile(tmpPos));
+void AreaCombat::compileFootprints() {
+	for (uint_fast8_t i = 0; i <= Direction::DIRECTION_LAST; ++i) {
+		Footprint &footprint = footprints[i];
+		footprint = {};
+
+		const auto &area = areas[i];
+		if (!area) {
+			continue;
+		}
+
+		uint32_t centerY;
+		uint32_t centerX;
+		area->getCenter(centerY, centerX);
+
+		// The target itself is always part of the box, sight lines start there
+		int32_t minX = 0, minY = 0, maxX = 0, maxY = 0;
+		for (uint32_t y = 0; y < area->getRows(); ++y) {
+			for (uint32_t x = 0; x < area->getCols(); ++x) {
+				if (!area->getValue(y, x)) {
+					continue;
 				}
+
+				const int32_t offsetX = static_cast<int32_t>(x) - static_cast<int32_t>(centerX);
+				const int32_t offsetY = static_cast<int32_t>(y) - static_cast<int32_t>(centerY);
+				footprint.offsets.emplace_back(offsetX, offsetY);
+				minX = std::min(minX, offsetX);
+				minY = std::min(minY, offsetY);
+				maxX = std::max(maxX, offsetX);
+				maxY = std::max(maxY, offsetY);
 			}
 		}
+
+		footprint.offsets.shrink_to_fit();
+		footprint.minX = minX;
+		footprint.minY = minY;
+		footprint.width = maxX - minX + 1;
+		footprint.height = maxY - minY + 1;
 	}
 }
 
@@ -1985,6 +2077,7 @@ void AreaCombat::setupArea(const std::list<uint32_t> &list, uint32_t rows) {
 	areas[DIRECTION_SOUTH] = std::move(southArea);
 	areas[DIRECTION_EAST] = std::move(eastArea);
 	areas[DIRECTION_WEST] = std::move(westArea);
+	compileFootprints();
 }
 
 void AreaCombat::setupArea(int32_t length, int32_t spread) {
@@ -2083,6 +2176,7 @@ void AreaCombat::setupExtArea(const std::list<uint32_t> &list, uint32_t rows) {
 	areas[DIRECTION_SOUTHWEST] = std::move(swArea);
 	areas[DIRECTION_NORTHEAST] = std::move(neArea);
 	areas[DIRECTION_SOUTHEAST] = std::move(seArea);
+	compileFootprints();
 }
 
 //**********************************************************//
@@ -218,7 +218,12 @@ public:
 	// non-assignable
 	AreaCombat &operator=(const AreaCombat &) = delete;
 
-	void getList(const Position &centerPos, const Position &targetPos, std::vector<std::shared_ptr<Tile>> &list) const;
+	/**
+	 * Collects the tiles of the area that are in sight of targetPos.
+	 * Cells without a tile are never created; they are reported in missingList (if given)
+	 * so callers can still show effects on them, or create them when something must be placed there.
+	 */
+	void getList(const Position &centerPos, const Position &targetPos, std::vector<std::shared_ptr<Tile>> &list, std::vector<Position>* missingList = nullptr) const;
 
 	void setupArea(const std::list<uint32_t> &list, uint32_t rows);
 	void setupArea(int32_t length, int32_t spread);
@@ -233,8 +238,9 @@ public:
 private:
 	std::unique_ptr<MatrixArea> createArea(const std::list<uint32_t> &list, uint32_t rows);
 	void copyArea(const std::unique_ptr<MatrixArea> &input, const std::unique_ptr<MatrixArea> &output, MatrixOperation_t op) const;
+	void compileFootprints();
 
-	const std::unique_ptr<MatrixArea> &getArea(const Position &centerPos, const Position &targetPos) const {
+	Direction getDirection(const Position &centerPos, const Position &targetPos) const {
 		int32_t dx = Position::getOffsetX(targetPos, centerPos);
 		int32_t dy = Position::getOffsetY(targetPos, centerPos);
 
@@ -261,10 +267,21 @@ private:
 			}
 		}
 
-		return areas[dir];
+		return dir;
 	}
 
+	// Marked cells of a direction's area as offsets from the target position (row order),
+	// with the bounding box that holds them and the target itself
+	struct Footprint {
+		std::vector<std::pair<int16_t, int16_t>> offsets;
+		int16_t minX = 0;
+		int16_t minY = 0;
+		uint16_t width = 0;
+		uint16_t height = 0;
+	};
+
 	std::array<std::unique_ptr<MatrixArea>, Direction::DIRECTION_LAST + 1> areas {};
+	std::array<Footprint, Direction::DIRECTION_LAST + 1> footprints {};
 	bool hasExtArea = false;
 };
 
@@ -290,7 +307,7 @@ public:
 	static void doCombatDispel(std::shared_ptr<Creature> caster, std::shared_ptr<Creature> target, const CombatParams &params);
 	static void doCombatDispel(std::shared_ptr<Creature> caster, const Position &position, const std::unique_ptr<AreaCombat> &area, const CombatParams &params);
 
-	static void getCombatArea(const Position &centerPos, const Position &targetPos, const std::unique_ptr<AreaCombat> &area, std::vector<std::shared_ptr<Tile>> &list);
+	static void getCombatArea(const Position &centerPos, const Position &targetPos, const std::unique_ptr<AreaCombat> &area, std::vector<std::shared_ptr<Tile>> &list, std::vector<Position>* missingList = nullptr);
 
 	static bool isInPvpZone(std::shared_ptr<Creature> attacker, std::shared_ptr<Creature> target);
 	static bool isProtected(std::shared_ptr<Player> attacker, std::shared_ptr<Player> target);
@@ -103,6 +103,8 @@ TalkActionResult_t Spells::playerSaySpell(std::shared_ptr<Player> player, std::s
 
 void Spells::clear() {
 	instants.clear();
+	instantWords.clear();
+	instantWordsDirty = false;
 	runes.clear();
 }
 
@@ -205,37 +207,32 @@ std::shared_ptr<RuneSpell> Spells::getRuneSpellByName(const std::string &name) {
 }
 
 std::shared_ptr<InstantSpell> Spells::getInstantSpell(const std::string &words) {
-	std::shared_ptr<InstantSpell> result = nullptr;
-
-	for (auto &it : instants) {
-		const std::string &instantSpellWords = it.second->getWords();
-		size_t spellLen = instantSpellWords.length();
-		if (strncasecmp(instantSpellWords.c_str(), words.c_str(), spellLen) == 0) {
-			if (!result || spellLen > result->getWords().length()) {
-				result = it.second;
-				if (words.length() == spellLen) {
-					break;
-				}
-			}
+	if (instantWordsDirty) {
+		// Inserted in map order, so words that only differ in case resolve to the same spell as before
+		instantWords.clear();
+		for (const auto &it : instants) {
+			instantWords.insert(it.second->getWords(), it.second);
 		}
+		instantWordsDirty = false;
 	}
 
-	if (result) {
-		const std::string &resultWords = result->getWords();
-		if (words.length() > resultWords.length()) {
-			if (!result->getHasParam()) {
-				return nullptr;
-			}
+	size_t spellLen = 0;
+	const auto* result = instantWords.findLongestPrefix(words, &spellLen);
+	if (!result) {
+		return nullptr;
+	}
 
-			size_t spellLen = resultWords.length();
-			size_t paramLen = words.length() - spellLen;
-			if (paramLen < 2 || words[spellLen] != ' ') {
-				return nullptr;
-			}
+	if (words.length() > spellLen) {
+		if (!(*result)->getHasParam()) {
+			return nullptr;
+		}
+
+		size_t paramLen = words.length() - spellLen;
+		if (paramLen < 2 || words[spellLen] != ' ') {
+			return nullptr;
 		}
-		return result;
 	}
-	return nullptr;
+	return *result;
 }
 
 std::shared_ptr<InstantSpell> Spells::getInstantSpellById(uint16_t spellId) {
@@ -15,6 +15,7 @@
 #include "lua/creature/actions.hpp"
 #include "lua/creature/talkaction.hpp"
 #include "lua/scripts/scripts.hpp"
+#include "utils/word_trie.hpp"
 
 class InstantSpell;
 class RuneSpell;
@@ -59,7 +60,9 @@ public:
 	[[nodiscard]] bool hasInstantSpell(const std::string &word) const;
 
 	void setInstantSpell(const std::string &word, const std::shared_ptr<InstantSpell> instant) {
-		instants.try_emplace(word, instant);
+		if (instants.try_emplace(word, instant).second) {
+			instantWordsDirty = true;
+		}
 	}
 
 	void clear();
@@ -69,6 +72,9 @@ public:
 private:
 	std::map<uint16_t, std::shared_ptr<RuneSpell>> runes;
 	std::map<std::string, std::shared_ptr<InstantSpell>> instants;
+	// Spell words of instants, rebuilt on the first lookup after a change, see getInstantSpell
+	stdext::word_trie<std::shared_ptr<InstantSpell>> instantWords;
+	bool instantWordsDirty = false;
 
 	friend class CombatSpell;
 };
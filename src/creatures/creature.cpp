@@ -1367,7 +1367,7 @@ bool Creature::addCondition(std::shared_ptr<Condition> condition, bool attackerP
 	}
 
 	if (condition->startCondition(getCreature())) {
-		conditions.push_back(condition);
+		insertCondition(condition);
 		onAddCondition(condition->getType());
 		return true;
 	}
@@ -1397,7 +1397,7 @@ void Creature::removeCondition(ConditionType_t type) {
 			continue;
 		}
 
-		it = conditions.erase(it);
+		it = eraseCondition(it);
 
 		condition->endCondition(getCreature());
 
@@ -1425,7 +1425,7 @@ void Creature::removeCondition(ConditionType_t conditionType, ConditionId_t cond
 			}
 		}
 
-		it = conditions.erase(it);
+		it = eraseCondition(it);
 
 		condition->endCondition(getCreature());
 
@@ -1452,13 +1452,17 @@ void Creature::removeCondition(std::shared_ptr<Condition> condition) {
 		return;
 	}
 
-	conditions.erase(it);
+	eraseCondition(it);
 
 	condition->endCondition(getCreature());
 	onEndCondition(condition->getType());
 }
 
 std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type) const {
+	if (!hasConditionType(type)) {
+		return nullptr;
+	}
+
 	for (const auto &condition : conditions) {
 		if (condition->getType() == type) {
 			return condition;
@@ -1468,7 +1472,10 @@ std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type) const {
 }
 
 std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type, ConditionId_t conditionId, uint32_t subId /* = 0*/) const {
-	metrics::method_latency measure(__METHOD_NAME__);
+	if (!hasConditionType(type)) {
+		return nullptr;
+	}
+
 	for (const auto &condition : conditions) {
 		if (condition->getType() == type && condition->getId() == conditionId && condition->getSubId() == subId) {
 			return condition;
@@ -1479,6 +1486,10 @@ std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type, Conditio
 
 std::vector<std::shared_ptr<Condition>> Creature::getConditionsByType(ConditionType_t type) const {
 	std::vector<std::shared_ptr<Condition>> conditionsVec;
+	if (!hasConditionType(type)) {
+		return conditionsVec;
+	}
+
 	for (const auto &condition : conditions) {
 		if (condition->getType() == type) {
 			conditionsVec.push_back(condition);
@@ -1487,15 +1498,23 @@ std::vector<std::shared_ptr<Condition>> Creature::getConditionsByType(ConditionT
 	return conditionsVec;
 }
 
+namespace {
+	// Executions per condition type since the last report, only touched by the dispatcher
+	std::array<uint64_t, CONDITION_COUNT + 1> conditionExecutions {};
+}
+
 void Creature::executeConditions(uint32_t interval) {
 	metrics::method_latency measure(__METHOD_NAME__);
 	auto it = conditions.begin(), end = conditions.end();
 	while (it != end) {
 		std::shared_ptr<Condition> condition = *it;
-		if (!condition->executeCondition(getCreature(), interval)) {
-			ConditionType_t type = condition->getType();
+		ConditionType_t type = condition->getType();
+		if (type < conditionExecutions.size()) {
+			++conditionExecutions[type];
+		}
 
-			it = conditions.erase(it);
+		if (!condition->executeCondition(getCreature(), interval)) {
+			it = eraseCondition(it);
 
 			condition->endCondition(getCreature());
 
@@ -1506,9 +1525,19 @@ void Creature::executeConditions(uint32_t interval) {
 	}
 }
 
+void Creature::reportConditionExecutions() {
+	for (size_t type = 0; type < conditionExecutions.size(); ++type) {
+		if (conditionExecutions[type] == 0) {
+			continue;
+		}
+
+		g_metrics().addCounter("condition_executions", static_cast<double>(conditionExecutions[type]), { { "type", std::string(magic_enum::enum_name(static_cast<ConditionType_t>(type))) } });
+		conditionExecutions[type] = 0;
+	}
+}
+
 bool Creature::hasCondition(ConditionType_t type, uint32_t subId /* = 0*/) const {
-	metrics::method_latency measure(__METHOD_NAME__);
-	if (isSuppress(type, false)) {
+	if (!hasConditionType(type) || isSuppress(type, false)) {
 		return false;
 	}
 
@@ -1525,6 +1554,20 @@ bool Creature::hasCondition(ConditionType_t type, uint32_t subId /* = 0*/) const
 	return false;
 }
 
+void Creature::insertCondition(const std::shared_ptr<Condition> &condition) {
+	conditions.push_back(condition);
+	if (const auto type = condition->getType(); type < conditionTypeCount.size()) {
+		++conditionTypeCount[type];
+	}
+}
+
+ConditionList::iterator Creature::eraseCondition(ConditionList::iterator it) {
+	if (const auto type = (*it)->getType(); type < conditionTypeCount.size()) {
+		--conditionTypeCount[type];
+	}
+	return conditions.erase(it);
+}
+
 uint16_t Creature::getStepDuration(Direction dir) {
 	if (isRemoved()) {
 		return 0;
@@ -1734,10 +1777,7 @@ bool FrozenPathingConditionCall::operator()(const Position &startPos, const Posi
 }
 
 bool Creature::isInvisible() const {
-	return std::find_if(conditions.begin(), conditions.end(), [](const std::shared_ptr<Condition> &condition) {
-			   return condition->getType() == CONDITION_INVISIBLE;
-		   })
-		!= conditions.end();
+	return hasConditionType(CONDITION_INVISIBLE);
 }
 
 bool Creature::getPathTo(const Position &targetPos, std::vector<Direction> &dirList, const FindPathParams &fpp) {
@@ -403,6 +403,16 @@ public:
 	std::vector<std::shared_ptr<Condition>> getConditionsByType(ConditionType_t type) const;
 	void executeConditions(uint32_t interval);
 	bool hasCondition(ConditionType_t type, uint32_t subId = 0) const;
+	/**
+	 * Whether any condition of the type is active, regardless of subId or remaining time
+	 */
+	bool hasConditionType(ConditionType_t type) const {
+		return type >= conditionTypeCount.size() || conditionTypeCount[type] > 0;
+	}
+	/**
+	 * Sends the condition executions counted since the last report to the metrics, per condition type
+	 */
+	static void reportConditionExecutions();
 
 	virtual bool isImmune([[maybe_unused]] CombatType_t type) const {
 		return false;
@@ -718,7 +728,12 @@ protected:
 
 	std::vector<std::shared_ptr<Creature>> m_summons;
 	CreatureEventList eventsList;
+	// Only change it through insertCondition/eraseCondition, they keep conditionTypeCount in sync
 	ConditionList conditions;
+	std::array<uint16_t, CONDITION_COUNT + 1> conditionTypeCount {};
+
+	void insertCondition(const std::shared_ptr<Condition> &condition);
+	ConditionList::iterator eraseCondition(ConditionList::iterator it);
 
 	std::vector<Direction> listWalkDir;
 
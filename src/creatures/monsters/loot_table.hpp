@@ -0,0 +1,114 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "utils/const.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// A monster's loot list flattened once, with the item type lookups already resolved,
+// so a kill only draws one number per entry instead of rebuilding the loot table in Lua.
+struct CompiledLootEntry {
+	uint16_t itemId = 0;
+	uint32_t chance = 0;
+	uint32_t minCount = 1;
+	// maxCount - minCount + 1, only used by stackable items
+	uint32_t countRange = 1;
+	uint32_t charges = 0;
+	bool stackable = false;
+	bool creatureProduct = false;
+	bool unique = false;
+
+	int32_t subType = -1;
+	int32_t actionId = -1;
+	std::string text;
+};
+
+struct LootDrop {
+	uint16_t itemId = 0;
+	uint32_t count = 0;
+	bool gut = false;
+	// Last entry that dropped this item, carries subType, actionId and text
+	const CompiledLootEntry* entry = nullptr;
+};
+
+class LootTable {
+public:
+	void clear() {
+		entries.clear();
+	}
+
+	void add(CompiledLootEntry entry) {
+		entries.emplace_back(std::move(entry));
+	}
+
+	const std::vector<CompiledLootEntry> &getEntries() const {
+		return entries;
+	}
+
+	bool empty() const {
+		return entries.empty();
+	}
+
+	/**
+	 * Rolls every entry once, same rules as the datapack's generateLootRoll:
+	 * an entry drops when MAX_LOOTCHANCE-scaled roll * 100 / multiplier is below its chance,
+	 * repeated item ids add up and a dropped unique item is not rolled again.
+	 *	\param multiplier loot rate (config rate * event rate * factor), values below 1 count as 1
+	 *	\param gutPercent creature products chance percent when the gut charm is active, 0 otherwise
+	 *	\param drops receives one drop per item id, in loot order
+	 */
+	template <typename Generator>
+	void roll(double multiplier, uint32_t gutPercent, std::vector<LootDrop> &drops, Generator &generator) const {
+		multiplier = std::max(1.0, multiplier);
+		std::uniform_int_distribution<uint32_t> distribution(0, MAX_LOOTCHANCE);
+		for (const auto &entry : entries) {
+			auto it = std::find_if(drops.begin(), drops.end(), [&entry](const LootDrop &drop) {
+				return drop.itemId == entry.itemId;
+			});
+			if (it != drops.end() && it->entry && it->entry->unique) {
+				continue;
+			}
+
+			const bool gut = gutPercent > 0 && entry.creatureProduct;
+			const uint32_t chance = gut ? (entry.chance * gutPercent + 99) / 100 : entry.chance;
+			const double randValue = distribution(generator) * 100.0 / multiplier;
+			if (randValue >= chance) {
+				continue;
+			}
+
+			uint32_t count = 1;
+			if (entry.charges > 0) {
+				count = entry.charges;
+			} else if (entry.stackable) {
+				count = static_cast<uint32_t>(std::fmod(randValue, entry.countRange)) + entry.minCount;
+			}
+
+			if (count == 0) {
+				continue;
+			}
+
+			if (it == drops.end()) {
+				it = drops.emplace(drops.end(), LootDrop { entry.itemId });
+			}
+			it->count += count;
+			it->gut = gut;
+			it->entry = &entry;
+		}
+	}
+
+private:
+	std::vector<CompiledLootEntry> entries;
+};
@@ -110,19 +110,14 @@ bool Monster::canWalkOnFieldType(CombatType_t combatType) const {
 
 int32_t Monster::getReflectPercent(CombatType_t reflectType, bool useCharges) const {
 	int32_t result = Creature::getReflectPercent(reflectType, useCharges);
-	auto it = mType->info.reflectMap.find(reflectType);
-	if (it != mType->info.reflectMap.end()) {
-		result += it->second;
+	if (reflectType < COMBAT_COUNT) {
+		result += mType->info.reflectPercents[reflectType];
 	}
 	return result;
 }
 
 uint32_t Monster::getHealingCombatValue(CombatType_t healingType) const {
-	auto it = mType->info.healingMap.find(healingType);
-	if (it != mType->info.healingMap.end()) {
-		return it->second;
-	}
-	return 0;
+	return healingType < COMBAT_COUNT ? mType->info.healingPercents[healingType] : 0;
 }
 
 void Monster::onAttackedCreatureDisappear(bool) {
@@ -640,11 +635,7 @@ BlockType_t Monster::blockHit(std::shared_ptr<Creature> attacker, CombatType_t c
 	BlockType_t blockType = Creature::blockHit(attacker, combatType, damage, checkDefense, checkArmor);
 
 	if (damage != 0) {
-		int32_t elementMod = 0;
-		auto it = mType->info.elementMap.find(combatType);
-		if (it != mType->info.elementMap.end()) {
-			elementMod = it->second;
-		}
+		int32_t elementMod = combatType < COMBAT_COUNT ? mType->info.elementPercents[combatType] : 0;
 
 		// Wheel of destiny
 		std::shared_ptr<Player> player = attacker ? attacker->getPlayer() : nullptr;
@@ -2126,7 +2117,7 @@ bool Monster::isImmune(ConditionType_t conditionType) const {
 }
 
 bool Monster::isImmune(CombatType_t combatType) const {
-	return mType->info.m_damageImmunities[combatTypeToIndex(combatType)];
+	return combatType < COMBAT_COUNT && mType->info.m_damageImmunities[combatType];
 }
 
 void Monster::getPathSearchParams(const std::shared_ptr<Creature> &creature, FindPathParams &fpp) {
@@ -28,6 +28,33 @@ void MonsterType::loadLoot(const std::shared_ptr<MonsterType> monsterType, LootB
 	} else {
 		monsterType->info.lootItems.push_back(lootBlock);
 	}
+	monsterType->lootTableDirty = true;
+}
+
+const LootTable &MonsterType::getLootTable() {
+	if (!lootTableDirty) {
+		return lootTable;
+	}
+
+	lootTable.clear();
+	for (const auto &lootBlock : info.lootItems) {
+		const ItemType &itemType = Item::items[lootBlock.id];
+		CompiledLootEntry entry;
+		entry.itemId = lootBlock.id;
+		entry.chance = lootBlock.chance;
+		entry.minCount = lootBlock.countmin;
+		entry.countRange = lootBlock.countmax >= lootBlock.countmin ? lootBlock.countmax - lootBlock.countmin + 1 : 1;
+		entry.charges = itemType.charges;
+		entry.stackable = itemType.stackable;
+		entry.creatureProduct = itemType.type == ITEM_TYPE_CREATUREPRODUCT;
+		entry.unique = lootBlock.unique;
+		entry.subType = lootBlock.subType;
+		entry.actionId = lootBlock.actionId;
+		entry.text = lootBlock.text;
+		lootTable.add(std::move(entry));
+	}
+	lootTableDirty = false;
+	return lootTable;
 }
 
 bool MonsterType::canSpawn(const Position &pos) {
@@ -294,10 +321,8 @@ bool MonsterType::loadCallback(LuaScriptInterface* scriptInterface) {
 
 std::shared_ptr<MonsterType> Monsters::getMonsterType(const std::string &name, bool silent /* = false*/) const {
 	std::string lowerCaseName = asLowerCaseString(name);
-	if (auto it = monsters.find(lowerCaseName);
-	    it != monsters.end()
-	    // We will only return the MonsterType if it match the exact name of the monster
-	    && it->first.find(lowerCaseName) != it->first.npos) {
+	if (auto it = monstersByName.find(lowerCaseName);
+	    it != monstersByName.end()) {
 		return it->second;
 	}
 	if (!silent) {
@@ -307,12 +332,18 @@ std::shared_ptr<MonsterType> Monsters::getMonsterType(const std::string &name, b
 }
 
 std::shared_ptr<MonsterType> Monsters::getMonsterTypeByRaceId(uint16_t raceId, bool isBoss /* = false*/) const {
-	auto bossType = g_ioBosstiary().getMonsterTypeByBossRaceId(raceId);
-	if (isBoss && bossType) {
-		return bossType;
+	if (isBoss) {
+		if (auto bossType = g_ioBosstiary().getMonsterTypeByBossRaceId(raceId)) {
+			return bossType;
+		}
+	}
+
+	if (auto it = monstersByRaceId.find(raceId);
+	    it != monstersByRaceId.end()) {
+		return it->second;
 	}
 
-	auto monster_race_map = g_game().getBestiaryList();
+	const auto &monster_race_map = g_game().getBestiaryList();
 	auto it = monster_race_map.find(raceId);
 	if (it == monster_race_map.end()) {
 		return nullptr;
@@ -321,13 +352,27 @@ std::shared_ptr<MonsterType> Monsters::getMonsterTypeByRaceId(uint16_t raceId, b
 	return g_monsters().getMonsterType(it->second);
 }
 
+void Monsters::indexRaceId(uint16_t raceId) {
+	const auto &monster_race_map = g_game().getBestiaryList();
+	auto it = monster_race_map.find(raceId);
+	if (it == monster_race_map.end()) {
+		return;
+	}
+
+	// Same resolution as the lookup: the first name registered for the race id wins
+	if (auto mType = getMonsterType(it->second, true)) {
+		monstersByRaceId[raceId] = mType;
+	}
+}
+
 bool Monsters::tryAddMonsterType(const std::string &name, const std::shared_ptr<MonsterType> mType) {
 	std::string lowerName = asLowerCaseString(name);
-	if (monsters.find(lowerName) != monsters.end()) {
+	if (monstersByName.contains(lowerName)) {
 		g_logger().debug("[{}] the monster with name '{}' already exist", __FUNCTION__, name);
 		return false;
 	}
 
 	monsters[lowerName] = mType;
+	monstersByName[lowerName] = mType;
 	return true;
 }
@@ -11,6 +11,7 @@
 
 #include "io/io_bosstiary.hpp"
 #include "creatures/creature.hpp"
+#include "creatures/monsters/loot_table.hpp"
 #include "declarations.hpp"
 
 class Loot {
@@ -59,9 +60,10 @@ class MonsterType {
 	struct MonsterInfo {
 		LuaScriptInterface* scriptInterface {};
 
-		std::map<CombatType_t, int32_t> elementMap;
-		std::map<CombatType_t, int32_t> reflectMap;
-		std::map<CombatType_t, int32_t> healingMap;
+		// Indexed by CombatType_t (a dense enum), read on every hit the monster takes
+		std::array<int32_t, COMBAT_COUNT> elementPercents = {};
+		std::array<int32_t, COMBAT_COUNT> reflectPercents = {};
+		std::array<int32_t, COMBAT_COUNT> healingPercents = {};
 
 		std::vector<voiceBlock_t> voiceVector;
 
@@ -204,8 +206,14 @@ public:
 	}
 
 	void loadLoot(std::shared_ptr<MonsterType> monsterType, LootBlock lootblock);
+	// info.lootItems compiled for rolling, rebuilt after loot is added
+	const LootTable &getLootTable();
 
 	bool canSpawn(const Position &pos);
+
+private:
+	LootTable lootTable;
+	bool lootTableDirty = true;
 };
 
 class MonsterSpell {
@@ -269,17 +277,28 @@ public:
 
 	void clear() {
 		monsters.clear();
+		monstersByName.clear();
+		monstersByRaceId.clear();
 	}
 
 	std::shared_ptr<MonsterType> getMonsterType(const std::string &name, bool silent = false) const;
 	std::shared_ptr<MonsterType> getMonsterTypeByRaceId(uint16_t raceId, bool isBoss = false) const;
 	bool tryAddMonsterType(const std::string &name, std::shared_ptr<MonsterType> mType);
+	/**
+	 * Resolves the bestiary entry of the race id to its monster type and keeps it indexed,
+	 * called when a monster type registers its race id (scripts load, before the server serves players)
+	 */
+	void indexRaceId(uint16_t raceId);
 	bool deserializeSpell(std::shared_ptr<MonsterSpell> spell, spellBlock_t &sb, const std::string &description = "");
 
 	std::unique_ptr<LuaScriptInterface> scriptInterface;
 	std::map<std::string, std::shared_ptr<MonsterType>> monsters;
 
 private:
+	// Lower case name lookups, the ordered map above is kept for the callers that iterate it
+	phmap::flat_hash_map<std::string, std::shared_ptr<MonsterType>> monstersByName;
+	phmap::flat_hash_map<uint16_t, std::shared_ptr<MonsterType>> monstersByRaceId;
+
 	std::shared_ptr<ConditionDamage> getDamageCondition(ConditionType_t conditionType, int32_t maxDamage, int32_t minDamage, int32_t startDamage, uint32_t tickInterval);
 };
 
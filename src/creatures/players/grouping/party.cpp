@@ -13,6 +13,7 @@
 
 #include "creatures/players/grouping/party.hpp"
 #include "game/game.hpp"
+#include "game/scheduling/dispatcher.hpp"
 #include "lua/creature/events.hpp"
 #include "lua/callbacks/event_callback.hpp"
 #include "lua/callbacks/events_callbacks.hpp"
@@ -40,6 +41,10 @@ void Party::disband() {
 	if (!currentLeader) {
 		return;
 	}
+
+	flushSharedExperience();
+	stopActivityExpiry();
+	sharedExpMembers.clear();
 	m_leader.reset();
 
 	currentLeader->setParty(nullptr);
@@ -99,6 +104,9 @@ bool Party::leaveParty(std::shared_ptr<Player> player) {
 		return false;
 	}
 
+	// Kills made while the player was still a member
+	flushSharedExperience();
+
 	bool missingLeader = false;
 	if (leader == player) {
 		if (!memberList.empty()) {
@@ -225,6 +233,9 @@ bool Party::joinParty(const std::shared_ptr<Player> &player) {
 
 	inviteList.erase(it);
 
+	// Kills made before the player joined
+	flushSharedExperience();
+
 	std::ostringstream ss;
 	ss << player->getName() << " has joined the party.";
 	broadcastPartyMessage(MESSAGE_PARTY_MANAGEMENT, ss.str());
@@ -401,6 +412,34 @@ void Party::updateSharedExperience() {
 	}
 }
 
+void Party::updateSharedExperienceRange(const std::shared_ptr<Player> &player) {
+	if (!sharedExpActive) {
+		return;
+	}
+
+	auto leader = getLeader();
+	if (!leader) {
+		return;
+	}
+
+	const auto crossedRange = [this, &leader](const std::shared_ptr<Player> &member) {
+		const auto it = sharedExpMembers.find(member->getID());
+		return it == sharedExpMembers.end() || it->second.inRange != isInShareRange(leader, member);
+	};
+
+	// A leader step can move any member in or out of the range
+	bool changed = false;
+	if (player == leader) {
+		changed = std::ranges::any_of(memberList, crossedRange);
+	} else {
+		changed = crossedRange(player);
+	}
+
+	if (changed) {
+		updateSharedExperience();
+	}
+}
+
 const char* Party::getSharedExpReturnMessage(SharedExpStatus_t value) {
 	switch (value) {
 		case SHAREDEXP_OK:
@@ -428,6 +467,7 @@ bool Party::setSharedExperience(std::shared_ptr<Player> player, bool newSharedEx
 		return true;
 	}
 
+	flushSharedExperience();
 	this->sharedExpActive = newSharedExpActive;
 
 	if (newSharedExpActive) {
@@ -437,6 +477,8 @@ bool Party::setSharedExperience(std::shared_ptr<Player> player, bool newSharedEx
 			leader->sendTextMessage(MESSAGE_PARTY_MANAGEMENT, getSharedExpReturnMessage(sharedExpStatus));
 		}
 	} else {
+		stopActivityExpiry();
+		sharedExpMembers.clear();
 		if (!silent) {
 			leader->sendTextMessage(MESSAGE_PARTY_MANAGEMENT, "Shared Experience has been deactivated.");
 		}
@@ -462,7 +504,44 @@ void Party::shareExperience(uint64_t experience, std::shared_ptr<Creature> targe
 	leader->onGainSharedExperience(shareExperience, target);
 }
 
+void Party::addSharedExperience(uint64_t experience, const std::shared_ptr<Creature> &target) {
+	// Experience scripts only look at the monster type (boosted creature, prey) and the hazard flag
+	const auto monster = target ? target->getMonster() : nullptr;
+	const auto it = std::find_if(pendingSharedExperience.begin(), pendingSharedExperience.end(), [&monster, &target](const PendingSharedExperience &pending) {
+		if (!monster) {
+			return pending.target == target;
+		}
+		const auto pendingMonster = pending.target ? pending.target->getMonster() : nullptr;
+		return pendingMonster && pendingMonster->getMonsterType() == monster->getMonsterType() && pendingMonster->getHazard() == monster->getHazard();
+	});
+
+	if (it != pendingSharedExperience.end()) {
+		it->experience += experience;
+		return;
+	}
+
+	pendingSharedExperience.emplace_back(PendingSharedExperience { target, experience });
+	if (pendingSharedExperience.size() == 1) {
+		g_dispatcher().addEvent([party = getParty()] { party->flushSharedExperience(); }, "Party::flushSharedExperience");
+	}
+}
+
+void Party::flushSharedExperience() {
+	if (pendingSharedExperience.empty()) {
+		return;
+	}
+
+	const auto pending = std::move(pendingSharedExperience);
+	pendingSharedExperience.clear();
+	for (const auto &[target, experience] : pending) {
+		shareExperience(experience, target);
+	}
+}
+
 bool Party::canUseSharedExperience(std::shared_ptr<Player> player) {
+	if (const auto it = sharedExpMembers.find(player->getID()); it != sharedExpMembers.end()) {
+		return it->second.status == SHAREDEXP_OK;
+	}
 	return getMemberSharedExperienceStatus(std::move(player)) == SHAREDEXP_OK;
 }
 
@@ -475,12 +554,19 @@ SharedExpStatus_t Party::getMemberSharedExperienceStatus(std::shared_ptr<Player>
 		return SHAREDEXP_EMPTYPARTY;
 	}
 
-	uint32_t minLevel = getMinLevel();
+	return getMemberSharedExperienceStatus(player, getMinLevel(), isInShareRange(leader, player));
+}
+
+bool Party::isInShareRange(const std::shared_ptr<Player> &leader, const std::shared_ptr<Player> &player) {
+	return Position::areInRange<30, 30, 1>(leader->getPosition(), player->getPosition());
+}
+
+SharedExpStatus_t Party::getMemberSharedExperienceStatus(const std::shared_ptr<Player> &player, uint32_t minLevel, bool inRange) {
 	if (player->getLevel() < minLevel) {
 		return SHAREDEXP_LEVELDIFFTOOLARGE;
 	}
 
-	if (!Position::areInRange<30, 30, 1>(leader->getPosition(), player->getPosition())) {
+	if (!inRange) {
 		return SHAREDEXP_TOOFARAWAY;
 	}
 
@@ -538,33 +624,88 @@ bool Party::isPlayerActive(std::shared_ptr<Player> player) {
 	if (it == ticksMap.end()) {
 		return false;
 	}
-	uint64_t timeDiff = OTSYS_TIME() - it->second;
-	return timeDiff <= 2 * 60 * 1000;
+	const int64_t timeDiff = OTSYS_TIME() - it->second;
+	return timeDiff <= PARTY_MEMBER_ACTIVITY_TIMEOUT;
 }
 
 SharedExpStatus_t Party::getSharedExperienceStatus() {
+	sharedExpMembers.clear();
 	auto leader = getLeader();
-	if (!leader) {
+	if (!leader || memberList.empty()) {
+		stopActivityExpiry();
 		return SHAREDEXP_EMPTYPARTY;
 	}
-	SharedExpStatus_t leaderStatus = getMemberSharedExperienceStatus(leader);
-	if (leaderStatus != SHAREDEXP_OK) {
-		return leaderStatus;
-	}
 
-	for (const auto &member : getMembers()) {
-		SharedExpStatus_t memberStatus = getMemberSharedExperienceStatus(member);
-		if (memberStatus != SHAREDEXP_OK) {
-			return memberStatus;
+	// The level spread is the same for everyone, only computed once
+	const uint32_t minLevel = getMinLevel();
+	int64_t nextExpiry = 0;
+	SharedExpStatus_t partyStatus = SHAREDEXP_OK;
+	const auto updateMember = [&](const std::shared_ptr<Player> &player) {
+		const bool inRange = isInShareRange(leader, player);
+		const SharedExpStatus_t status = getMemberSharedExperienceStatus(player, minLevel, inRange);
+		sharedExpMembers[player->getID()] = { status, inRange };
+		if (partyStatus == SHAREDEXP_OK) {
+			partyStatus = status;
+		}
+
+		if (player->hasFlag(PlayerFlags_t::NotGainInFight)) {
+			return;
 		}
+		// The status changes by itself when the member becomes inactive
+		if (const auto it = ticksMap.find(player->getID()); it != ticksMap.end() && isPlayerActive(player)) {
+			const int64_t expiresAt = it->second + PARTY_MEMBER_ACTIVITY_TIMEOUT;
+			nextExpiry = nextExpiry == 0 ? expiresAt : std::min(nextExpiry, expiresAt);
+		}
+	};
+
+	updateMember(leader);
+	for (const auto &member : memberList) {
+		updateMember(member);
 	}
-	return SHAREDEXP_OK;
+
+	scheduleActivityExpiry(nextExpiry);
+	return partyStatus;
+}
+
+void Party::scheduleActivityExpiry(int64_t expiresAt) {
+	if (expiresAt == activityExpiresAt && activityExpiryEventId != 0) {
+		return;
+	}
+
+	stopActivityExpiry();
+	if (expiresAt == 0) {
+		return;
+	}
+
+	activityExpiresAt = expiresAt;
+	const auto delay = static_cast<uint32_t>(std::max<int64_t>(0, expiresAt - OTSYS_TIME()) + 1);
+	activityExpiryEventId = g_dispatcher().scheduleEvent(
+		delay, [weakParty = std::weak_ptr<Party>(getParty())] {
+			if (const auto party = weakParty.lock()) {
+				party->activityExpiryEventId = 0;
+				party->updateSharedExperience();
+			}
+		},
+		"Party::updateSharedExperience"
+	);
+}
+
+void Party::stopActivityExpiry() {
+	if (activityExpiryEventId != 0) {
+		g_dispatcher().stopEvent(activityExpiryEventId);
+		activityExpiryEventId = 0;
+	}
+	activityExpiresAt = 0;
 }
 
 void Party::updatePlayerTicks(std::shared_ptr<Player> player, uint32_t points) {
 	if (points != 0 && !player->hasFlag(PlayerFlags_t::NotGainInFight)) {
+		// Called on every hit, the status only changes when an inactive member becomes active
+		const bool wasActive = isPlayerActive(player);
 		ticksMap[player->getID()] = OTSYS_TIME();
-		updateSharedExperience();
+		if (!wasActive) {
+			updateSharedExperience();
+		}
 	}
 }
 
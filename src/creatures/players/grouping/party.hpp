@@ -74,6 +74,12 @@ public:
 	bool canOpenCorpse(uint32_t ownerId) const;
 
 	void shareExperience(uint64_t experience, std::shared_ptr<Creature> target = nullptr);
+	/**
+	 * Queues a kill's experience to be shared at the end of the tick.
+	 * Kills of the same monster type are merged, so each member gains (and is sent) the experience once.
+	 */
+	void addSharedExperience(uint64_t experience, const std::shared_ptr<Creature> &target);
+	void flushSharedExperience();
 	bool setSharedExperience(std::shared_ptr<Player> player, bool sharedExpActive, bool silent = false);
 	bool isSharedExperienceActive() const {
 		return sharedExpActive;
@@ -84,6 +90,8 @@ public:
 	bool canUseSharedExperience(std::shared_ptr<Player> player);
 	SharedExpStatus_t getMemberSharedExperienceStatus(std::shared_ptr<Player> player);
 	void updateSharedExperience();
+	// Recomputes the shared experience only if the player crossed the share range of the leader
+	void updateSharedExperienceRange(const std::shared_ptr<Player> &player);
 
 	void updatePlayerTicks(std::shared_ptr<Player> player, uint32_t points);
 	void clearPlayerPoints(std::shared_ptr<Player> player);
@@ -126,9 +134,24 @@ public:
 	std::vector<std::shared_ptr<PartyAnalyzer>> membersData;
 
 private:
+	struct SharedExpMember {
+		SharedExpStatus_t status = SHAREDEXP_OK;
+		bool inRange = false;
+	};
+
+	struct PendingSharedExperience {
+		std::shared_ptr<Creature> target;
+		uint64_t experience = 0;
+	};
+
 	const char* getSharedExpReturnMessage(SharedExpStatus_t value);
 	bool isPlayerActive(std::shared_ptr<Player> player);
+	static bool isInShareRange(const std::shared_ptr<Player> &leader, const std::shared_ptr<Player> &player);
+	SharedExpStatus_t getMemberSharedExperienceStatus(const std::shared_ptr<Player> &player, uint32_t minLevel, bool inRange);
+	// Recomputes every member status into sharedExpMembers and schedules the next activity expiry
 	SharedExpStatus_t getSharedExperienceStatus();
+	void scheduleActivityExpiry(int64_t expiresAt);
+	void stopActivityExpiry();
 	uint32_t getHighestLevel();
 	uint32_t getLowestLevel();
 	uint32_t getMinLevel();
@@ -137,6 +160,13 @@ private:
 
 	std::map<uint32_t, int64_t> ticksMap;
 
+	// Status of each member at the last recompute, only kept while shared experience is active
+	phmap::flat_hash_map<uint32_t, SharedExpMember> sharedExpMembers;
+	uint64_t activityExpiryEventId = 0;
+	int64_t activityExpiresAt = 0;
+
+	std::vector<PendingSharedExperience> pendingSharedExperience;
+
 	std::vector<std::shared_ptr<Player>> memberList;
 	std::vector<std::shared_ptr<Player>> inviteList;
 
@@ -558,7 +558,7 @@ void Player::updateInventoryWeight() {
 	}
 }
 
-void Player::updateInventoryImbuement() {
+bool Player::updateInventoryImbuement() {
 	// Get the tile the player is currently on
 	std::shared_ptr<Tile> playerTile = getTile();
 	// Check if the player is in a protection zone
@@ -566,11 +566,16 @@ void Player::updateInventoryImbuement() {
 	// Check if the player is in fight mode
 	bool isInFightMode = hasCondition(CONDITION_INFIGHT);
 	bool nonAggressiveFightOnly = g_configManager().getBoolean(TOGGLE_IMBUEMENT_NON_AGGRESSIVE_FIGHT_ONLY, __FUNCTION__);
+	bool hasImbuements = false;
 
 	// Iterate through all items in the player's inventory
-	for (auto [key, item] : getAllSlotItems()) {
-		// Iterate through all imbuement slots on the item
+	for (uint8_t inventorySlot = CONST_SLOT_FIRST; inventorySlot <= CONST_SLOT_LAST; ++inventorySlot) {
+		const auto &item = inventory[inventorySlot];
+		if (!item) {
+			continue;
+		}
 
+		// Iterate through all imbuement slots on the item
 		for (uint8_t slotid = 0; slotid < item->getImbuementSlot(); slotid++) {
 			ImbuementInfo imbuementInfo;
 			// Get the imbuement information for the current slot
@@ -588,10 +593,12 @@ void Player::updateInventoryImbuement() {
 			bool isInBackpack = parent && parent->getContainer();
 			// If the imbuement is aggressive and the player is not in fight mode or is in a protection zone, or the item is in a container, ignore it.
 			if (categoryImbuement && (categoryImbuement->agressive || nonAggressiveFightOnly) && (isInProtectionZone || !isInFightMode || isInBackpack)) {
+				hasImbuements = true;
 				continue;
 			}
 			// If the item is not in the backpack slot and it's not a agressive imbuement, ignore it.
 			if (categoryImbuement && !categoryImbuement->agressive && parent && parent != getPlayer()) {
+				hasImbuements = true;
 				continue;
 			}
 
@@ -613,8 +620,27 @@ void Player::updateInventoryImbuement() {
 				updateImbuementTrackerStats();
 				continue;
 			}
+			hasImbuements = true;
+		}
+	}
+	return hasImbuements;
+}
+
+bool Player::hasImbuedInventoryItems() const {
+	for (uint8_t inventorySlot = CONST_SLOT_FIRST; inventorySlot <= CONST_SLOT_LAST; ++inventorySlot) {
+		const auto &item = inventory[inventorySlot];
+		if (!item) {
+			continue;
+		}
+
+		for (uint8_t slotid = 0; slotid < item->getImbuementSlot(); slotid++) {
+			ImbuementInfo imbuementInfo;
+			if (item->getImbuementInfo(slotid, &imbuementInfo)) {
+				return true;
+			}
 		}
 	}
+	return false;
 }
 
 phmap::flat_hash_map<uint8_t, std::shared_ptr<Item>> Player::getAllSlotItems() const {
@@ -1516,6 +1542,7 @@ void Player::onApplyImbuement(Imbuement* imbuement, std::shared_ptr<Item> item,
 	}
 
 	item->addImbuement(slot, imbuement->getID(), baseImbuement->duration);
+	g_game().addImbuementPlayer(getPlayer());
 	openImbuementWindow(item);
 }
 
@@ -1982,7 +2009,7 @@ void Player::onCreatureMove(const std::shared_ptr<Creature> &creature, const std
 	}
 
 	if (m_party) {
-		m_party->updateSharedExperience();
+		m_party->updateSharedExperienceRange(getPlayer());
 		m_party->updatePlayerStatus(getPlayer(), oldPos, newPos);
 	}
 
@@ -2895,7 +2922,7 @@ void Player::death(std::shared_ptr<Creature> lastHitCreature) {
 			std::shared_ptr<Condition> condition = *it;
 			// isSupress block to delete spells conditions (ensures that the player cannot, for example, reset the cooldown time of the familiar and summon several)
 			if (condition->isPersistent() && condition->isRemovableOnDeath()) {
-				it = conditions.erase(it);
+				it = eraseCondition(it);
 
 				condition->endCondition(static_self_cast<Player>());
 				onEndCondition(condition->getType());
@@ -2910,7 +2937,7 @@ void Player::death(std::shared_ptr<Creature> lastHitCreature) {
 		while (it != end) {
 			std::shared_ptr<Condition> condition = *it;
 			if (condition->isPersistent()) {
-				it = conditions.erase(it);
+				it = eraseCondition(it);
 
 				condition->endCondition(static_self_cast<Player>());
 				onEndCondition(condition->getType());
@@ -4160,6 +4187,10 @@ void Player::postAddNotification(std::shared_ptr<Thing> thing, std::shared_ptr<C
 	if (link == LINK_OWNER) {
 		// calling movement scripts
 		g_moveEvents().onPlayerEquip(getPlayer(), thing->getItem(), static_cast<Slots_t>(index), false);
+
+		if (const auto &item = thing->getItem(); item && item->getImbuementSlot() > 0) {
+			g_game().addImbuementPlayer(getPlayer());
+		}
 	}
 
 	bool requireListUpdate = true;
@@ -4843,7 +4874,7 @@ void Player::onGainExperience(uint64_t gainExp, std::shared_ptr<Creature> target
 	}
 
 	if (target && !target->getPlayer() && m_party && m_party->isSharedExperienceActive() && m_party->isSharedExperienceEnabled()) {
-		m_party->shareExperience(gainExp, target);
+		m_party->addSharedExperience(gainExp, target);
 		// We will get a share of the experience through the sharing mechanism
 		return;
 	}
@@ -506,6 +506,11 @@ public:
 		return client ? client->getIP() : 0;
 	}
 
+	// Known creatures the client had to forget to make room for new ones, since login
+	uint32_t getKnownCreatureEvictions() const {
+		return client ? client->getKnownCreatureEvictions() : 0;
+	}
+
 	bool isDisconnected() const {
 		return getIP() == 0;
 	}
@@ -2675,10 +2680,12 @@ private:
 
 	void updateInventoryWeight();
 	/**
-	 * @brief Starts checking the imbuements in the item so that the time decay is performed
-	 * Registers the player in an unordered_map in game.h so that the function can be initialized by the task
+	 * @brief Decays the imbuements of the equipped items that are active right now
+	 * Called by Game::checkImbuements for the players it tracks
+	 * @return false once no equipped item holds an imbuement, so the player stops being tracked
 	 */
-	void updateInventoryImbuement();
+	bool updateInventoryImbuement();
+	bool hasImbuedInventoryItems() const;
 
 	void setNextWalkActionTask(std::shared_ptr<Task> task);
 	void setNextWalkTask(std::shared_ptr<Task> task);
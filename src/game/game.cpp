@@ -26,6 +26,7 @@
 #include "io/iomarket.hpp"
 #include "items/items.hpp"
 #include "lua/scripts/lua_environment.hpp"
+#include "lua/scripts/lua_profiler.hpp"
 #include "creatures/monsters/monster.hpp"
 #include "lua/creature/movement.hpp"
 #include "game/scheduling/dispatcher.hpp"
@@ -430,7 +431,7 @@ void Game::loadBoostedCreature() {
 	}
 
 	const uint16_t oldRace = result->getNumber<uint16_t>("raceid");
-	const auto monsterlist = getBestiaryList();
+	const auto &monsterlist = getBestiaryList();
 
 	struct MonsterRace {
 		uint16_t raceId { 0 };
@@ -517,9 +518,24 @@ void Game::start(ServiceManager* manager) {
 	g_dispatcher().cycleEvent(
 		EVENT_IMBUEMENT_INTERVAL, [this] { checkImbuements(); }, "Game::checkImbuements"
 	);
+	g_dispatcher().cycleEvent(
+		EVENT_STATUS_CACHE_INTERVAL, [] { ProtocolStatus::refreshStatusCache(); }, "ProtocolStatus::refreshStatusCache"
+	);
+	g_dispatcher().cycleEvent(
+		EVENT_CONDITION_REPORT_INTERVAL, [] { Creature::reportConditionExecutions(); }, "Creature::reportConditionExecutions"
+	);
+	g_dispatcher().cycleEvent(
+		EVENT_CALLBACK_REPORT_INTERVAL, [] { g_callbacks().reportExecutions(); }, "EventsCallbacks::reportExecutions"
+	);
 	g_dispatcher().cycleEvent(
 		EVENT_LUA_GARBAGE_COLLECTION, [this] { g_luaEnvironment().collectGarbage(); }, "Calling GC"
 	);
+	auto kvFlushIntervalSeconds = g_configManager().getNumber(KV_FLUSH_INTERVAL, __FUNCTION__);
+	if (kvFlushIntervalSeconds > 0) {
+		g_dispatcher().cycleEvent(
+			kvFlushIntervalSeconds * 1000, [] { g_saveManager().scheduleKV(); }, "SaveManager::scheduleKV"
+		);
+	}
 	auto marketItemsPriceIntervalMinutes = g_configManager().getNumber(MARKET_REFRESH_PRICES, __FUNCTION__);
 	if (marketItemsPriceIntervalMinutes > 0) {
 		auto marketItemsPriceIntervalMS = marketItemsPriceIntervalMinutes * 60000;
@@ -530,6 +546,21 @@ void Game::start(ServiceManager* manager) {
 			marketItemsPriceIntervalMS, [this] { loadItemsPrice(); }, "Game::loadItemsPrice"
 		);
 	}
+	g_dispatcher().getProfiler().setCycleBudget(g_configManager().getNumber(DISPATCHER_CYCLE_BUDGET, __FUNCTION__));
+	if (g_configManager().getBoolean(LUA_PROFILER_ENABLED, __FUNCTION__)) {
+		g_luaProfiler().start();
+	}
+	auto luaProfilerDumpIntervalSeconds = g_configManager().getNumber(LUA_PROFILER_DUMP_INTERVAL, __FUNCTION__);
+	if (luaProfilerDumpIntervalSeconds > 0) {
+		g_dispatcher().cycleEvent(
+			luaProfilerDumpIntervalSeconds * 1000, [] {
+				if (g_luaProfiler().isRunning()) {
+					g_luaProfiler().dump();
+				}
+			},
+			"LuaProfiler::dump"
+		);
+	}
 }
 
 GameState_t Game::getGameState() const {
@@ -625,23 +656,19 @@ void Game::setGameState(GameState_t newState) {
 }
 
 void Game::loadItemsPrice() {
-	IOMarket::getInstance().updateStatistics();
+	itemsPriceMap.clear();
 
-	// Update purchased offers (market_history)
-	const auto &stats = IOMarket::getInstance().getPurchaseStatistics();
-	for (const auto &[itemId, itemStats] : stats) {
-		std::map<uint8_t, uint64_t> tierToPrice;
-		for (const auto &[tier, tierStats] : itemStats) {
-			auto averagePrice = tierStats.totalPrice / tierStats.numTransactions;
-			tierToPrice[tier] = averagePrice;
+	// Update purchased offers (market statistics)
+	for (const auto &[key, statistics] : IOMarket::getInstance().getPurchaseStatistics()) {
+		if (statistics.numTransactions > 0) {
+			itemsPriceMap[key] = statistics.totalPrice / statistics.numTransactions;
 		}
-		itemsPriceMap[itemId] = tierToPrice;
 	}
 
-	// Update active buy offers (market_offers)
-	auto offers = IOMarket::getInstance().getActiveOffers(MARKETACTION_BUY);
-	for (const auto &offer : offers) {
-		itemsPriceMap[offer.itemId][offer.tier] = std::max(itemsPriceMap[offer.itemId][offer.tier], offer.price);
+	// Update active buy offers (market order book)
+	for (const auto &offer : IOMarket::getActiveOffers(MARKETACTION_BUY)) {
+		auto &price = itemsPriceMap[IOMarket::getItemTierKey(offer.itemId, offer.tier)];
+		price = std::max(price, offer.price);
 	}
 }
 
@@ -3249,10 +3276,11 @@ uint64_t Game::getItemMarketPrice(const std::map<uint16_t, uint64_t> &itemMap, b
 		} else if (it.first == ITEM_CRYSTAL_COIN) {
 			total += 10000 * it.second;
 		} else {
-			auto marketIt = itemsPriceMap.find(it.first);
-			if (marketIt != itemsPriceMap.end()) {
-				for (auto &[tier, price] : (*marketIt).second) {
-					total += price * it.second;
+			auto marketIt = itemsPriceMap.lower_bound(IOMarket::getItemTierKey(it.first, 0));
+			const auto marketEnd = itemsPriceMap.upper_bound(IOMarket::getItemTierKey(it.first, 0xFF));
+			if (marketIt != marketEnd) {
+				for (; marketIt != marketEnd; ++marketIt) {
+					total += marketIt->second * it.second;
 				}
 			} else {
 				const ItemType &iType = Item::items[it.first];
@@ -7895,12 +7923,22 @@ void Game::addDistanceEffect(const CreatureVector &spectators, const Position &f
 }
 
 void Game::checkImbuements() {
-	for (const auto &[mapPlayerId, mapPlayer] : getPlayers()) {
-		if (!mapPlayer) {
-			continue;
+	std::vector<uint32_t> untrackedPlayers;
+	for (const auto playerId : imbuementPlayers) {
+		const auto &player = getPlayerByID(playerId);
+		if (!player || !player->updateInventoryImbuement()) {
+			untrackedPlayers.emplace_back(playerId);
 		}
+	}
 
-		mapPlayer->updateInventoryImbuement();
+	for (const auto playerId : untrackedPlayers) {
+		imbuementPlayers.erase(playerId);
+	}
+}
+
+void Game::addImbuementPlayer(const std::shared_ptr<Player> &player) {
+	if (player && player->hasImbuedInventoryItems()) {
+		imbuementPlayers.emplace(player->getID());
 	}
 }
 
@@ -8000,6 +8038,8 @@ void Game::shutdown() {
 
 	g_luaEnvironment().collectGarbage();
 
+	IOMarket::getInstance().flushWrites();
+
 	g_logger().info("Done!");
 }
 
@@ -8922,7 +8962,7 @@ void Game::playerCreateMarketOffer(uint32_t playerId, uint8_t type, uint16_t ite
 		return;
 	}
 
-	IOMarket::createOffer(player->getGUID(), static_cast<MarketAction_t>(type), it.id, amount, price, tier, anonymous);
+	IOMarket::createOffer(player->getGUID(), player->getName(), static_cast<MarketAction_t>(type), it.id, amount, price, tier, anonymous);
 
 	const MarketOfferList &buyOffers = IOMarket::getActiveOffers(MARKETACTION_BUY, it.id, tier);
 	const MarketOfferList &sellOffers = IOMarket::getActiveOffers(MARKETACTION_SELL, it.id, tier);
@@ -9767,6 +9807,8 @@ void Game::addPlayer(std::shared_ptr<Player> player) {
 	mappedPlayerNames[lowercase_name] = player;
 	wildcardTree->insert(lowercase_name);
 	players[player->getID()] = player;
+	ProtocolStatus::addOnlinePlayer(player->getID(), player->getIP());
+	addImbuementPlayer(player);
 }
 
 void Game::removePlayer(std::shared_ptr<Player> player) {
@@ -9774,6 +9816,8 @@ void Game::removePlayer(std::shared_ptr<Player> player) {
 	mappedPlayerNames.erase(lowercase_name);
 	wildcardTree->remove(lowercase_name);
 	players.erase(player->getID());
+	ProtocolStatus::removeOnlinePlayer(player->getID());
+	imbuementPlayers.erase(player->getID());
 }
 
 void Game::addNpc(std::shared_ptr<Npc> npc) {
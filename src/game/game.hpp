@@ -531,7 +531,8 @@ public:
 
 	void sendOfflineTrainingDialog(std::shared_ptr<Player> player);
 
-	const std::map<uint16_t, std::map<uint8_t, uint64_t>> &getItemsPrice() const {
+	// [uint32_t = IOMarket::getItemTierKey, uint64_t = price], ordered by item id then tier
+	const phmap::btree_map<uint32_t, uint64_t> &getItemsPrice() const {
 		return itemsPriceMap;
 	}
 	const phmap::parallel_flat_hash_map<uint32_t, std::shared_ptr<Guild>> &getGuilds() const {
@@ -553,6 +554,10 @@ public:
 
 	void addPlayer(std::shared_ptr<Player> player);
 	void removePlayer(std::shared_ptr<Player> player);
+	/**
+	 * Tracks the player if an equipped item holds an imbuement, checkImbuements only visits tracked players
+	 */
+	void addImbuementPlayer(const std::shared_ptr<Player> &player);
 
 	void addNpc(std::shared_ptr<Npc> npc);
 	void removeNpc(std::shared_ptr<Npc> npc);
@@ -755,6 +760,7 @@ private:
 	std::map<uint32_t, int32_t> forgeMonsterEventIds;
 	std::unordered_set<uint32_t> fiendishMonsters;
 	std::unordered_set<uint32_t> influencedMonsters;
+	std::unordered_set<uint32_t> imbuementPlayers;
 	void checkImbuements();
 	bool playerSaySpell(std::shared_ptr<Player> player, SpeakClasses type, const std::string &text);
 	void playerWhisper(std::shared_ptr<Player> player, const std::string &text);
@@ -915,7 +921,7 @@ private:
 	std::string motdHash;
 	uint32_t motdNum = 0;
 
-	std::map<uint16_t, std::map<uint8_t, uint64_t>> itemsPriceMap;
+	phmap::btree_map<uint32_t, uint64_t> itemsPriceMap;
 
 	std::vector<ItemClassification*> itemsClassifications;
 
@@ -29,9 +29,11 @@ void Dispatcher::init() {
 		while (!threadPool.isStopped()) {
 			UPDATE_OTSYS_TIME();
 
+			profiler.beginCycle();
 			executeEvents();
 			executeScheduledEvents();
 			mergeEvents();
+			profiler.endCycle();
 
 			if (!hasPendingTasks) {
 				signalSchedule.wait_for(asyncLock, timeUntilNextScheduledTask());
@@ -44,18 +46,26 @@ void Dispatcher::executeSerialEvents(std::vector<Task> &tasks) {
 	dispacherContext.group = TaskGroup::Serial;
 	dispacherContext.type = DispatcherType::Event;
 
+	const auto phaseStart = DispatcherProfiler::Clock::now();
+	auto taskStart = phaseStart;
 	for (const auto &task : tasks) {
 		dispacherContext.taskName = task.getContext();
 		if (task.execute()) {
 			++dispatcherCycle;
 		}
+
+		const auto taskEnd = DispatcherProfiler::Clock::now();
+		profiler.addTask(task.getContext(), taskEnd - taskStart);
+		taskStart = taskEnd;
 	}
 	tasks.clear();
+	profiler.addPhase(DispatcherPhase::Serial, taskStart - phaseStart);
 
 	dispacherContext.reset();
 }
 
 void Dispatcher::executeParallelEvents(std::vector<Task> &tasks, const uint8_t groupId) {
+	const auto phaseStart = DispatcherProfiler::Clock::now();
 	asyncWait(tasks.size(), [groupId, &tasks](size_t i) {
 		dispacherContext.type = DispatcherType::AsyncEvent;
 		dispacherContext.group = static_cast<TaskGroup>(groupId);
@@ -65,6 +75,7 @@ void Dispatcher::executeParallelEvents(std::vector<Task> &tasks, const uint8_t g
 	});
 
 	tasks.clear();
+	profiler.addPhase(DispatcherPhase::Parallel, DispatcherProfiler::Clock::now() - phaseStart);
 }
 
 void Dispatcher::asyncWait(size_t requestSize, std::function<void(size_t i)> &&f) {
@@ -122,6 +133,8 @@ void Dispatcher::executeEvents(const TaskGroup startGroup) {
 void Dispatcher::executeScheduledEvents() {
 	auto &threadScheduledTasks = getThreadTask()->scheduledTasks;
 
+	const auto phaseStart = DispatcherProfiler::Clock::now();
+	auto taskStart = phaseStart;
 	auto it = scheduledTasks.begin();
 	while (it != scheduledTasks.end()) {
 		const auto &task = *it;
@@ -140,8 +153,13 @@ void Dispatcher::executeScheduledEvents() {
 			scheduledTasksRef.erase(task->getId());
 		}
 
+		const auto taskEnd = DispatcherProfiler::Clock::now();
+		profiler.addTask(task->getContext(), taskEnd - taskStart);
+		taskStart = taskEnd;
+
 		++it;
 	}
+	profiler.addPhase(DispatcherPhase::Scheduled, taskStart - phaseStart);
 
 	if (it != scheduledTasks.begin()) {
 		scheduledTasks.erase(scheduledTasks.begin(), it);
@@ -158,6 +176,7 @@ void Dispatcher::mergeAsyncEvents() {
 	constexpr uint8_t start = static_cast<uint8_t>(TaskGroup::GenericParallel);
 	constexpr uint8_t end = static_cast<uint8_t>(TaskGroup::Last);
 
+	const auto phaseStart = DispatcherProfiler::Clock::now();
 	for (const auto &thread : threads) {
 		std::scoped_lock lock(thread->mutex);
 		for (uint_fast8_t i = start; i < end; ++i) {
@@ -167,12 +186,14 @@ void Dispatcher::mergeAsyncEvents() {
 			}
 		}
 	}
+	profiler.addPhase(DispatcherPhase::Merge, DispatcherProfiler::Clock::now() - phaseStart);
 }
 
 // Merge thread events with main dispatch events
 void Dispatcher::mergeEvents() {
 	constexpr uint8_t serial = static_cast<uint8_t>(TaskGroup::Serial);
 
+	const auto phaseStart = DispatcherProfiler::Clock::now();
 	for (const auto &thread : threads) {
 		std::scoped_lock lock(thread->mutex);
 		if (!thread->tasks[serial].empty()) {
@@ -185,6 +206,7 @@ void Dispatcher::mergeEvents() {
 			thread->scheduledTasks.clear();
 		}
 	}
+	profiler.addPhase(DispatcherPhase::Merge, DispatcherProfiler::Clock::now() - phaseStart);
 
 	checkPendingTasks();
 }
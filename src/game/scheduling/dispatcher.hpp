@@ -10,6 +10,7 @@
 #pragma once
 
 #include "task.hpp"
+#include "game/scheduling/dispatcher_profiler.hpp"
 #include "lib/thread/thread_pool.hpp"
 
 static constexpr uint16_t DISPATCHER_TASK_EXPIRATION = 2000;
@@ -132,6 +133,11 @@ public:
 		return dispacherContext;
 	}
 
+	// Only to be used from the dispatcher thread
+	DispatcherProfiler &getProfiler() {
+		return profiler;
+	}
+
 private:
 	thread_local static DispatcherContext dispacherContext;
 
@@ -219,6 +225,8 @@ private:
 
 	bool asyncWaitDisabled = false;
 
+	DispatcherProfiler profiler;
+
 	friend class CanaryServer;
 };
 
@@ -0,0 +1,186 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "game/scheduling/dispatcher_profiler.hpp"
+#include "lib/metrics/metrics.hpp"
+
+namespace {
+	constexpr std::array<std::string_view, static_cast<uint8_t>(DispatcherPhase::Last)> phaseNames {
+		"serial",
+		"parallel",
+		"scheduled",
+		"merge",
+	};
+
+	// Percentile of a copy of the samples, nearest rank
+	int64_t getPercentile(std::vector<int64_t> samples, double percentile) {
+		if (samples.empty()) {
+			return 0;
+		}
+
+		const auto rank = static_cast<size_t>(percentile * (samples.size() - 1) + 0.5);
+		std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+		return samples[rank];
+	}
+
+	double toMs(int64_t ns) {
+		return ns / 1e6;
+	}
+}
+
+void DispatcherProfiler::beginCycle() {
+	cycle = {};
+	cycleTasks.clear();
+	cycleStart = Clock::now();
+}
+
+void DispatcherProfiler::endCycle() {
+	if (cycle.tasks == 0) {
+		return;
+	}
+
+	cycle.totalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - cycleStart).count();
+
+	if (cycles.size() < CYCLE_HISTORY) {
+		cycles.emplace_back(cycle);
+	} else {
+		cycles[nextCycle] = cycle;
+	}
+	nextCycle = (nextCycle + 1) % CYCLE_HISTORY;
+	++totalCycles;
+
+	static const auto cyclesCounter = g_metrics().counter("dispatcher_cycles");
+	static const auto overBudgetCounter = g_metrics().counter("dispatcher_cycles_over_budget");
+	static const auto phaseCounters = [] {
+		std::array<metrics::CounterHandle, static_cast<uint8_t>(DispatcherPhase::Last)> handles;
+		for (size_t phase = 0; phase < handles.size(); ++phase) {
+			handles[phase] = g_metrics().counter("dispatcher_phase_ms", { { "phase", std::string(phaseNames[phase]) } });
+		}
+		return handles;
+	}();
+
+	cyclesCounter.add(1);
+	for (size_t phase = 0; phase < phaseCounters.size(); ++phase) {
+		if (cycle.phaseNs[phase] > 0) {
+			phaseCounters[phase].add(toMs(cycle.phaseNs[phase]));
+		}
+	}
+
+	if (cycleBudgetNs > 0 && cycle.totalNs > cycleBudgetNs) {
+		++overBudgetCycles;
+		overBudgetCounter.add(1);
+		reportOverBudget();
+	}
+}
+
+void DispatcherProfiler::addTask(std::string_view context, Clock::duration duration) {
+	const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+	++cycle.tasks;
+
+	// Heterogeneous lookup, the name is only copied the first time a context runs
+	auto it = contexts.find(context);
+	if (it == contexts.end()) {
+		it = contexts.emplace(std::string(context), ContextStats {}).first;
+	}
+	cycleTasks.emplace_back(&it->first, ns);
+
+	auto &stats = it->second;
+	++stats.count;
+	stats.totalNs += ns;
+	stats.maxNs = std::max(stats.maxNs, ns);
+	if (stats.samples.size() < CONTEXT_SAMPLES) {
+		stats.samples.emplace_back(ns);
+	} else {
+		stats.samples[stats.nextSample] = ns;
+	}
+	stats.nextSample = (stats.nextSample + 1) % CONTEXT_SAMPLES;
+}
+
+void DispatcherProfiler::reportOverBudget() const {
+	// Same context may run several times in a cycle
+	phmap::flat_hash_map<std::string_view, int64_t> byContext;
+	for (const auto &[context, ns] : cycleTasks) {
+		byContext[*context] += ns;
+	}
+
+	std::vector<std::pair<std::string_view, int64_t>> top(byContext.begin(), byContext.end());
+	const size_t count = std::min<size_t>(5, top.size());
+	std::partial_sort(top.begin(), top.begin() + count, top.end(), [](const auto &a, const auto &b) {
+		return a.second > b.second;
+	});
+
+	std::string breakdown;
+	for (size_t phase = 0; phase < phaseNames.size(); ++phase) {
+		fmt::format_to(std::back_inserter(breakdown), "{}{} {:.2f} ms", phase > 0 ? ", " : "", phaseNames[phase], toMs(cycle.phaseNs[phase]));
+	}
+	breakdown += "; top:";
+	for (size_t i = 0; i < count; ++i) {
+		fmt::format_to(std::back_inserter(breakdown), " {} {:.2f} ms", top[i].first, toMs(top[i].second));
+	}
+
+	g_logger().warn("[DispatcherProfiler] - Cycle took {:.2f} ms (budget {:.2f} ms, {} tasks): {}", toMs(cycle.totalNs), toMs(cycleBudgetNs), cycle.tasks, breakdown);
+}
+
+std::string DispatcherProfiler::getReport(size_t limit) const {
+	std::vector<int64_t> cycleTimes;
+	cycleTimes.reserve(cycles.size());
+	std::array<int64_t, static_cast<uint8_t>(DispatcherPhase::Last)> phaseTotals {};
+	int64_t maxCycle = 0;
+	for (const auto &sample : cycles) {
+		cycleTimes.emplace_back(sample.totalNs);
+		maxCycle = std::max(maxCycle, sample.totalNs);
+		for (size_t phase = 0; phase < phaseTotals.size(); ++phase) {
+			phaseTotals[phase] += sample.phaseNs[phase];
+		}
+	}
+
+	std::string report = fmt::format(
+		"Dispatcher: {} cycles ({} over budget), last {}: p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms\n",
+		totalCycles, overBudgetCycles, cycles.size(), toMs(getPercentile(cycleTimes, 0.5)), toMs(getPercentile(cycleTimes, 0.99)), toMs(maxCycle)
+	);
+
+	report += "Average per cycle:";
+	for (size_t phase = 0; phase < phaseTotals.size(); ++phase) {
+		const double average = cycles.empty() ? 0.0 : toMs(phaseTotals[phase]) / cycles.size();
+		fmt::format_to(std::back_inserter(report), " {} {:.3f} ms", phaseNames[phase], average);
+	}
+
+	std::vector<std::pair<std::string_view, const ContextStats*>> sorted;
+	sorted.reserve(contexts.size());
+	for (const auto &[context, stats] : contexts) {
+		sorted.emplace_back(context, &stats);
+	}
+
+	const size_t count = std::min(limit, sorted.size());
+	std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(), [](const auto &a, const auto &b) {
+		return a.second->totalNs > b.second->totalNs;
+	});
+
+	report += "\n\nContexts (runs, total ms, p50 ms, p99 ms, max ms):\n";
+	for (size_t i = 0; i < count; ++i) {
+		const auto &[context, stats] = sorted[i];
+		fmt::format_to(
+			std::back_inserter(report), "{} | {:.2f} | {:.3f} | {:.3f} | {:.3f} | {}\n",
+			stats->count, toMs(stats->totalNs), toMs(getPercentile(stats->samples, 0.5)), toMs(getPercentile(stats->samples, 0.99)), toMs(stats->maxNs), context
+		);
+	}
+	return report;
+}
+
+void DispatcherProfiler::reset() {
+	cycles.clear();
+	nextCycle = 0;
+	totalCycles = 0;
+	overBudgetCycles = 0;
+	// Called from a task, the current cycle must not keep pointers to the cleared names
+	cycleTasks.clear();
+	contexts.clear();
+}
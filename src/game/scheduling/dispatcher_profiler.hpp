@@ -0,0 +1,84 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+enum class DispatcherPhase : uint8_t {
+	Serial,
+	Parallel,
+	Scheduled,
+	Merge,
+	Last
+};
+
+/**
+ * Records where each dispatcher cycle goes: time per phase and per task context.
+ * The last cycles are kept in a ring buffer and every context keeps its last durations,
+ * so the report can show p50/p99/max without any histogram.
+ * Only the dispatcher thread touches it (parallel tasks are accounted as a whole in their phase).
+ */
+class DispatcherProfiler {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr size_t CYCLE_HISTORY = 1024;
+	static constexpr size_t CONTEXT_SAMPLES = 256;
+
+	void beginCycle();
+	void endCycle();
+
+	void addPhase(DispatcherPhase phase, Clock::duration duration) {
+		cycle.phaseNs[static_cast<uint8_t>(phase)] += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+	}
+
+	void addTask(std::string_view context, Clock::duration duration);
+
+	// Cycles above the budget are logged with their breakdown, 0 disables it
+	void setCycleBudget(uint32_t ms) {
+		cycleBudgetNs = static_cast<int64_t>(ms) * 1000000;
+	}
+
+	/**
+	 * Cycle percentiles, average phase split and the most expensive contexts by total time.
+	 *	\param limit max number of contexts
+	 */
+	std::string getReport(size_t limit) const;
+	void reset();
+
+private:
+	struct CycleSample {
+		int64_t totalNs = 0;
+		std::array<int64_t, static_cast<uint8_t>(DispatcherPhase::Last)> phaseNs {};
+		uint32_t tasks = 0;
+	};
+
+	struct ContextStats {
+		uint64_t count = 0;
+		int64_t totalNs = 0;
+		int64_t maxNs = 0;
+		std::vector<int64_t> samples;
+		size_t nextSample = 0;
+	};
+
+	void reportOverBudget() const;
+
+	Clock::time_point cycleStart;
+	CycleSample cycle;
+	// Contexts run in the current cycle, for the over budget breakdown; they point to the keys of contexts
+	std::vector<std::pair<const std::string*, int64_t>> cycleTasks;
+
+	std::vector<CycleSample> cycles;
+	size_t nextCycle = 0;
+	uint64_t totalCycles = 0;
+	uint64_t overBudgetCycles = 0;
+	int64_t cycleBudgetNs = 0;
+
+	// Task contexts are owned by the tasks, so the names are copied; nodes keep the keys at a stable address
+	phmap::node_hash_map<std::string, ContextStats> contexts;
+};
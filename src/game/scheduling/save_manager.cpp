@@ -50,6 +50,16 @@ void SaveManager::scheduleAll() {
 	});
 }
 
+void SaveManager::scheduleKV() {
+	if (kv.dirtySize() == 0) {
+		return;
+	}
+
+	threadPool.detach_task([this]() {
+		saveKV();
+	});
+}
+
 void SaveManager::schedulePlayer(std::weak_ptr<Player> playerPtr) {
 	auto playerToSave = playerPtr.lock();
 	if (!playerToSave) {
@@ -149,5 +159,5 @@ void SaveManager::saveKV() {
 	}
 
 	auto duration = bm_saveKV.duration();
-	logger.debug("Key-value store saved in {} milliseconds.", duration);
+	logger.debug("Key-value store saved in {} milliseconds, {} keys flushed.", duration, kv.lastFlushedKeys());
 }
@@ -23,6 +23,7 @@ public:
 
 	void saveAll();
 	void scheduleAll();
+	void scheduleKV();
 
 	bool savePlayer(std::shared_ptr<Player> player);
 	void saveGuild(std::shared_ptr<Guild> guild);
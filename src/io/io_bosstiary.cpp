@@ -32,7 +32,7 @@ void IOBosstiary::loadBoostedBoss() {
 	auto time = localtime(&timeNow);
 	auto today = time->tm_mday;
 
-	auto bossMap = getBosstiaryMap();
+	const auto &bossMap = getBosstiaryMap();
 	if (bossMap.size() <= 1) {
 		g_logger().error("[{}] It is not possible to create a boosted boss with only one registered boss. (CODE 02)", __FUNCTION__);
 		return;
@@ -51,7 +51,7 @@ void IOBosstiary::loadBoostedBoss() {
 
 	// Filter only archfoe bosses
 	std::map<uint16_t, std::string> bossInfo;
-	for (auto [infoBossRaceId, infoBossName] : bossMap) {
+	for (const auto &[infoBossRaceId, infoBossName] : bossMap) {
 		const auto mType = getMonsterTypeByBossRaceId(infoBossRaceId);
 		if (!mType || mType->info.bosstiaryRace != BosstiaryRarity_t::RARITY_ARCHFOE) {
 			continue;
@@ -154,19 +154,16 @@ uint16_t IOBosstiary::getBoostedBossId() const {
 }
 
 std::shared_ptr<MonsterType> IOBosstiary::getMonsterTypeByBossRaceId(uint16_t raceId) const {
-	for ([[maybe_unused]] const auto &[bossRaceId, bossName] : getBosstiaryMap()) {
-		if (bossRaceId == raceId) {
-			const auto monsterType = g_monsters().getMonsterType(bossName);
-			if (!monsterType) {
-				g_logger().error("[{}] Boss with id {} not found in boss map", __FUNCTION__, raceId);
-				continue;
-			}
-
-			return monsterType;
-		}
+	auto it = bosstiaryMap.find(raceId);
+	if (it == bosstiaryMap.end()) {
+		return nullptr;
 	}
 
-	return nullptr;
+	const auto monsterType = g_monsters().getMonsterType(it->second);
+	if (!monsterType) {
+		g_logger().error("[{}] Boss with id {} not found in boss map", __FUNCTION__, raceId);
+	}
+	return monsterType;
 }
 
 void IOBosstiary::addBosstiaryKill(std::shared_ptr<Player> player, const std::shared_ptr<MonsterType> mtype, uint32_t amount /*= 1*/) const {
@@ -115,7 +115,7 @@ std::shared_ptr<Charm> IOBestiary::getBestiaryCharm(charmRune_t activeCharm, boo
 }
 
 std::map<uint16_t, std::string> IOBestiary::findRaceByName(const std::string &race, bool Onlystring /*= true*/, BestiaryType_t raceNumber /*= BESTY_RACE_NONE*/) const {
-	std::map<uint16_t, std::string> best_list = g_game().getBestiaryList();
+	const auto &best_list = g_game().getBestiaryList();
 	std::map<uint16_t, std::string> race_list;
 
 	if (Onlystring) {
@@ -189,7 +189,7 @@ uint16_t IOBestiary::getBestiaryRaceUnlocked(std::shared_ptr<Player> player, Bes
 	}
 
 	uint16_t count = 0;
-	std::map<uint16_t, std::string> besty_l = g_game().getBestiaryList();
+	const auto &besty_l = g_game().getBestiaryList();
 
 	for (const auto &it : besty_l) {
 		const auto mtype = g_monsters().getMonsterType(it.second);
@@ -350,31 +350,32 @@ std::map<uint8_t, int16_t> IOBestiary::getMonsterElements(const std::shared_ptr<
 	for (uint8_t i = 0; i <= 7; i++) {
 		defaultMap[i] = 100;
 	}
-	for (const auto &elementEntry : mtype->info.elementMap) {
-		switch (elementEntry.first) {
+	for (size_t combatType = 0; combatType < COMBAT_COUNT; ++combatType) {
+		const auto percent = static_cast<int16_t>(mtype->info.elementPercents[combatType]);
+		switch (indexToCombatType(combatType)) {
 			case COMBAT_PHYSICALDAMAGE:
-				defaultMap[0] -= static_cast<int16_t>(elementEntry.second);
+				defaultMap[0] -= percent;
 				break;
 			case COMBAT_FIREDAMAGE:
-				defaultMap[1] -= static_cast<int16_t>(elementEntry.second);
+				defaultMap[1] -= percent;
 				break;
 			case COMBAT_EARTHDAMAGE:
-				defaultMap[2] -= static_cast<int16_t>(elementEntry.second);
+				defaultMap[2] -= percent;
 				break;
 			case COMBAT_ENERGYDAMAGE:
-				defaultMap[3] -= static_cast<int16_t>(elementEntry.second);
+				defaultMap[3] -= percent;
 				break;
 			case COMBAT_ICEDAMAGE:
-				defaultMap[4] -= static_cast<int16_t>(elementEntry.second);
+				defaultMap[4] -= percent;
 				break;
 			case COMBAT_HOLYDAMAGE:
-				defaultMap[5] -= static_cast<int16_t>(elementEntry.second);
+				defaultMap[5] -= percent;
 				break;
 			case COMBAT_DEATHDAMAGE:
-				defaultMap[6] -= static_cast<int16_t>(elementEntry.second);
+				defaultMap[6] -= percent;
 				break;
 			case COMBAT_HEALING:
-				defaultMap[7] -= static_cast<int16_t>(elementEntry.second);
+				defaultMap[7] -= percent;
 				break;
 			default:
 				break;
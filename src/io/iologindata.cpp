@@ -72,17 +72,18 @@ uint8_t IOLoginData::getAccountType(uint32_t accountId) {
 
 void IOLoginData::updateOnlineStatus(uint32_t guid, bool login) {
 	static phmap::flat_hash_map<uint32_t, bool> updateOnline;
+	static const auto playersOnline = g_metrics().upDownCounter("players_online");
 	if ((login && updateOnline.find(guid) != updateOnline.end()) || guid <= 0) {
 		return;
 	}
 
 	std::ostringstream query;
 	if (login) {
-		g_metrics().addUpDownCounter("players_online", 1);
+		playersOnline.add(1);
 		query << "INSERT INTO `players_online` VALUES (" << guid << ')';
 		updateOnline[guid] = true;
 	} else {
-		g_metrics().addUpDownCounter("players_online", -1);
+		playersOnline.add(-1);
 		query << "DELETE FROM `players_online` WHERE `player_id` = " << guid;
 		updateOnline.erase(guid);
 	}
@@ -10,11 +10,11 @@
 #include "pch.hpp"
 
 #include "io/iomarket.hpp"
-#include "database/databasetasks.hpp"
 #include "io/iologindata.hpp"
 #include "game/game.hpp"
 #include "game/scheduling/dispatcher.hpp"
 #include "game/scheduling/save_manager.hpp"
+#include "lib/thread/thread_pool.hpp"
 
 uint8_t IOMarket::getTierFromDatabaseTable(const std::string &string) {
 	auto tier = static_cast<uint8_t>(std::atoi(string.c_str()));
@@ -26,144 +26,241 @@ uint8_t IOMarket::getTierFromDatabaseTable(const std::string &string) {
 	return tier;
 }
 
-MarketOfferList IOMarket::getActiveOffers(MarketAction_t action) {
-	MarketOfferList offerList;
-
-	std::string query = fmt::format(
-		"SELECT `id`, `itemtype`, `amount`, `price`, `tier`, `created`, `anonymous`, "
-		"(SELECT `name` FROM `players` WHERE `id` = `player_id`) AS `player_name` "
-		"FROM `market_offers` WHERE `sale` = {}",
-		action
+void IOMarket::loadOffers() {
+	offers.clear();
+	offersByItem.clear();
+	offersByPlayer.clear();
+	offersByCounter.clear();
+	historyByPlayer.clear();
+	nextOfferId = 1;
+
+	DBResult_ptr result = g_database().storeQuery(
+		"SELECT `market_offers`.`id`, `player_id`, `sale`, `itemtype`, `amount`, `created`, `anonymous`, `price`, `tier`, `players`.`name` AS `player_name` "
+		"FROM `market_offers` LEFT JOIN `players` ON `players`.`id` = `market_offers`.`player_id`"
 	);
+	if (result) {
+		do {
+			ActiveMarketOffer offer;
+			offer.id = result->getNumber<uint32_t>("id");
+			offer.playerId = result->getNumber<uint32_t>("player_id");
+			offer.type = static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale"));
+			offer.itemId = result->getNumber<uint16_t>("itemtype");
+			offer.amount = result->getNumber<uint16_t>("amount");
+			offer.created = result->getNumber<uint32_t>("created");
+			offer.anonymous = result->getNumber<uint16_t>("anonymous") != 0;
+			offer.price = result->getNumber<uint64_t>("price");
+			offer.tier = getTierFromDatabaseTable(result->getString("tier"));
+			offer.playerName = result->getString("player_name");
+			nextOfferId = std::max(nextOfferId, offer.id + 1);
+			addOffer(std::move(offer));
+		} while (result->next());
+	}
 
-	DBResult_ptr result = g_database().storeQuery(query);
-	if (!result) {
-		return offerList;
+	// Same window the startup script keeps in `market_history`
+	const time_t historyStart = getTimeNow() - g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
+	result = g_database().storeQuery(fmt::format(
+		"SELECT `player_id`, `sale`, `itemtype`, `amount`, `price`, `expires_at`, `state`, `tier` FROM `market_history` WHERE `inserted` > {}",
+		historyStart
+	));
+	size_t historyCount = 0;
+	if (result) {
+		do {
+			HistoryMarketOffer offer;
+			offer.itemId = result->getNumber<uint16_t>("itemtype");
+			offer.amount = result->getNumber<uint16_t>("amount");
+			offer.price = result->getNumber<uint64_t>("price");
+			offer.timestamp = result->getNumber<uint32_t>("expires_at");
+			offer.tier = getTierFromDatabaseTable(result->getString("tier"));
+			offer.state = static_cast<MarketOfferState_t>(result->getNumber<uint16_t>("state"));
+			addHistory(result->getNumber<uint32_t>("player_id"), static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale")), offer);
+			++historyCount;
+		} while (result->next());
+	}
+
+	g_logger().info("Loaded {} market offers and {} history entries", offers.size(), historyCount);
+}
+
+void IOMarket::addOffer(ActiveMarketOffer offer) {
+	const uint32_t offerId = offer.id;
+	offersByItem[getBookKey(offer.itemId, offer.tier, offer.type)].insert(offerId);
+	offersByPlayer[offer.playerId].insert(offerId);
+	offersByCounter[getCounterKey(offer.created, offerId & 0xFFFF)] = offerId;
+	offers.insert_or_assign(offerId, std::move(offer));
+}
+
+void IOMarket::removeOffer(uint32_t offerId) {
+	const auto it = offers.find(offerId);
+	if (it == offers.end()) {
+		return;
+	}
+
+	const auto &offer = it->second;
+	if (auto bookIt = offersByItem.find(getBookKey(offer.itemId, offer.tier, offer.type)); bookIt != offersByItem.end()) {
+		bookIt->second.erase(offerId);
+		if (bookIt->second.empty()) {
+			offersByItem.erase(bookIt);
+		}
+	}
+	if (auto playerIt = offersByPlayer.find(offer.playerId); playerIt != offersByPlayer.end()) {
+		playerIt->second.erase(offerId);
+		if (playerIt->second.empty()) {
+			offersByPlayer.erase(playerIt);
+		}
+	}
+	offersByCounter.erase(getCounterKey(offer.created, offerId & 0xFFFF));
+	offers.erase(it);
+}
+
+void IOMarket::addHistory(uint32_t playerId, MarketAction_t type, HistoryMarketOffer offer) {
+	if (offer.state == OFFERSTATE_ACCEPTEDEX) {
+		offer.state = OFFERSTATE_ACCEPTED;
+	}
+	historyByPlayer[playerId][type == MARKETACTION_SELL ? 1 : 0].push_back(offer);
+}
+
+void IOMarket::persist(std::string query) {
+	std::scoped_lock lock(writeMutex);
+	pendingWrites.emplace_back(std::move(query));
+	if (writing) {
+		return;
 	}
 
+	writing = true;
+	inject<ThreadPool>().detach_task([this] { drainWrites(); });
+}
+
+void IOMarket::drainWrites() {
+	while (true) {
+		std::string query;
+		{
+			std::scoped_lock lock(writeMutex);
+			if (pendingWrites.empty()) {
+				writing = false;
+				writesDone.notify_all();
+				return;
+			}
+			query = std::move(pendingWrites.front());
+			pendingWrites.pop_front();
+		}
+
+		if (!g_database().executeQuery(query)) {
+			g_logger().error("[{}] Failed to write market change: {}", __FUNCTION__, query);
+		}
+	}
+}
+
+void IOMarket::flushWrites() {
+	std::unique_lock lock(writeMutex);
+	writesDone.wait(lock, [this] { return !writing; });
+}
+
+MarketOfferList IOMarket::getActiveOffers(MarketAction_t action) {
+	MarketOfferList offerList;
+
 	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
 
-	do {
-		MarketOffer offer;
-		offer.itemId = result->getNumber<uint16_t>("itemtype");
-		offer.amount = result->getNumber<uint16_t>("amount");
-		offer.price = result->getNumber<uint64_t>("price");
-		offer.timestamp = result->getNumber<uint32_t>("created") + marketOfferDuration;
-		offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-		if (result->getNumber<uint16_t>("anonymous") == 0) {
-			offer.playerName = result->getString("player_name");
-		} else {
-			offer.playerName = "Anonymous";
+	for (const auto &[offerId, activeOffer] : getInstance().offers) {
+		if (activeOffer.type != action) {
+			continue;
 		}
-		offer.tier = getTierFromDatabaseTable(result->getString("tier"));
+
+		MarketOffer offer;
+		offer.itemId = activeOffer.itemId;
+		offer.amount = activeOffer.amount;
+		offer.price = activeOffer.price;
+		offer.timestamp = activeOffer.created + marketOfferDuration;
+		offer.counter = offerId & 0xFFFF;
+		offer.playerName = activeOffer.anonymous ? "Anonymous" : activeOffer.playerName;
+		offer.tier = activeOffer.tier;
 		offerList.push_back(offer);
-	} while (result->next());
+	}
 	return offerList;
 }
 
 MarketOfferList IOMarket::getActiveOffers(MarketAction_t action, uint16_t itemId, uint8_t tier) {
 	MarketOfferList offerList;
 
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `tier`, `created`, `anonymous`, (SELECT `name` FROM `players` WHERE `id` = `player_id`) AS `player_name` FROM `market_offers` WHERE `sale` = " << action << " AND `itemtype` = " << itemId << " AND `tier` = " << std::to_string(tier);
-
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
+	const auto &market = getInstance();
+	const auto bookIt = market.offersByItem.find(getBookKey(itemId, tier, action));
+	if (bookIt == market.offersByItem.end()) {
 		return offerList;
 	}
 
 	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
 
-	do {
+	for (const uint32_t offerId : bookIt->second) {
+		const auto &activeOffer = market.offers.at(offerId);
 		MarketOffer offer;
 		offer.itemId = itemId;
-		offer.amount = result->getNumber<uint16_t>("amount");
-		offer.price = result->getNumber<uint64_t>("price");
-		offer.timestamp = result->getNumber<uint32_t>("created") + marketOfferDuration;
-		offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-		if (result->getNumber<uint16_t>("anonymous") == 0) {
-			offer.playerName = result->getString("player_name");
-		} else {
-			offer.playerName = "Anonymous";
-		}
-		offer.tier = getTierFromDatabaseTable(result->getString("tier"));
+		offer.amount = activeOffer.amount;
+		offer.price = activeOffer.price;
+		offer.timestamp = activeOffer.created + marketOfferDuration;
+		offer.counter = offerId & 0xFFFF;
+		offer.playerName = activeOffer.anonymous ? "Anonymous" : activeOffer.playerName;
+		offer.tier = tier;
 		offerList.push_back(offer);
-	} while (result->next());
+	}
 	return offerList;
 }
 
 MarketOfferList IOMarket::getOwnOffers(MarketAction_t action, uint32_t playerId) {
 	MarketOfferList offerList;
 
-	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
-
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `created`, `itemtype`, `tier` FROM `market_offers` WHERE `player_id` = " << playerId << " AND `sale` = " << action;
-
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
+	const auto &market = getInstance();
+	const auto playerIt = market.offersByPlayer.find(playerId);
+	if (playerIt == market.offersByPlayer.end()) {
 		return offerList;
 	}
 
-	do {
+	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
+
+	for (const uint32_t offerId : playerIt->second) {
+		const auto &activeOffer = market.offers.at(offerId);
+		if (activeOffer.type != action) {
+			continue;
+		}
+
 		MarketOffer offer;
-		offer.amount = result->getNumber<uint16_t>("amount");
-		offer.price = result->getNumber<uint64_t>("price");
-		offer.timestamp = result->getNumber<uint32_t>("created") + marketOfferDuration;
-		offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-		offer.itemId = result->getNumber<uint16_t>("itemtype");
-		offer.tier = getTierFromDatabaseTable(result->getString("tier"));
+		offer.amount = activeOffer.amount;
+		offer.price = activeOffer.price;
+		offer.timestamp = activeOffer.created + marketOfferDuration;
+		offer.counter = offerId & 0xFFFF;
+		offer.itemId = activeOffer.itemId;
+		offer.tier = activeOffer.tier;
 		offerList.push_back(offer);
-	} while (result->next());
+	}
 	return offerList;
 }
 
 HistoryMarketOfferList IOMarket::getOwnHistory(MarketAction_t action, uint32_t playerId) {
-	HistoryMarketOfferList offerList;
-
-	std::ostringstream query;
-	query << "SELECT `itemtype`, `amount`, `price`, `expires_at`, `state`, `tier` FROM `market_history` WHERE `player_id` = " << playerId << " AND `sale` = " << action;
-
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
-		return offerList;
+	const auto &market = getInstance();
+	const auto it = market.historyByPlayer.find(playerId);
+	if (it == market.historyByPlayer.end()) {
+		return {};
 	}
-
-	do {
-		HistoryMarketOffer offer;
-		offer.itemId = result->getNumber<uint16_t>("itemtype");
-		offer.amount = result->getNumber<uint16_t>("amount");
-		offer.price = result->getNumber<uint64_t>("price");
-		offer.timestamp = result->getNumber<uint32_t>("expires_at");
-		offer.tier = getTierFromDatabaseTable(result->getString("tier"));
-
-		MarketOfferState_t offerState = static_cast<MarketOfferState_t>(result->getNumber<uint16_t>("state"));
-		if (offerState == OFFERSTATE_ACCEPTEDEX) {
-			offerState = OFFERSTATE_ACCEPTED;
-		}
-
-		offer.state = offerState;
-
-		offerList.push_back(offer);
-	} while (result->next());
-	return offerList;
+	return it->second[action == MARKETACTION_SELL ? 1 : 0];
 }
 
-void IOMarket::processExpiredOffers(DBResult_ptr result, bool) {
-	if (!result) {
-		return;
+void IOMarket::processExpiredOffers() {
+	const time_t lastExpireDate = getTimeNow() - g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
+
+	std::vector<ActiveMarketOffer> expiredOffers;
+	for (const auto &[offerId, offer] : getInstance().offers) {
+		if (offer.created <= lastExpireDate) {
+			expiredOffers.emplace_back(offer);
+		}
 	}
 
-	do {
-		if (!IOMarket::moveOfferToHistory(result->getNumber<uint32_t>("id"), OFFERSTATE_EXPIRED)) {
+	for (const auto &expiredOffer : expiredOffers) {
+		if (!IOMarket::moveOfferToHistory(expiredOffer.id, OFFERSTATE_EXPIRED)) {
 			continue;
 		}
 
-		const uint32_t playerId = result->getNumber<uint32_t>("player_id");
-		const uint16_t amount = result->getNumber<uint16_t>("amount");
-		auto tier = getTierFromDatabaseTable(result->getString("tier"));
-		if (result->getNumber<uint16_t>("sale") == 1) {
-			const ItemType &itemType = Item::items[result->getNumber<uint16_t>("itemtype")];
+		const uint32_t playerId = expiredOffer.playerId;
+		const uint16_t amount = expiredOffer.amount;
+		auto tier = expiredOffer.tier;
+		if (expiredOffer.type == MARKETACTION_SELL) {
+			const ItemType &itemType = Item::items[expiredOffer.itemId];
 			if (itemType.id == 0) {
 				continue;
 			}
@@ -214,7 +311,7 @@ void IOMarket::processExpiredOffers(DBResult_ptr result, bool) {
 				g_saveManager().savePlayer(player);
 			}
 		} else {
-			uint64_t totalPrice = result->getNumber<uint64_t>("price") * amount;
+			uint64_t totalPrice = expiredOffer.price * amount;
 
 			std::shared_ptr<Player> player = g_game().getPlayerByGUID(playerId);
 			if (player) {
@@ -223,15 +320,12 @@ void IOMarket::processExpiredOffers(DBResult_ptr result, bool) {
 				IOLoginData::increaseBankBalance(playerId, totalPrice);
 			}
 		}
-	} while (result->next());
+	}
 }
 
 void IOMarket::checkExpiredOffers() {
-	const time_t lastExpireDate = getTimeNow() - g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
-
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `itemtype`, `player_id`, `sale`, `tier` FROM `market_offers` WHERE `created` <= " << lastExpireDate;
-	g_databaseTasks().store(query.str(), IOMarket::processExpiredOffers);
+	// Deferred so the offers that expired while the server was offline are returned once the game runs
+	g_dispatcher().addEvent(IOMarket::processExpiredOffers, "IOMarket::processExpiredOffers");
 
 	int32_t checkExpiredMarketOffersEachMinutes = g_configManager().getNumber(CHECK_EXPIRED_MARKET_OFFERS_EACH_MINUTES, __FUNCTION__);
 	if (checkExpiredMarketOffersEachMinutes <= 0) {
@@ -242,14 +336,12 @@ void IOMarket::checkExpiredOffers() {
 }
 
 uint32_t IOMarket::getPlayerOfferCount(uint32_t playerId) {
-	std::ostringstream query;
-	query << "SELECT COUNT(*) AS `count` FROM `market_offers` WHERE `player_id` = " << playerId;
-
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
+	const auto &market = getInstance();
+	const auto it = market.offersByPlayer.find(playerId);
+	if (it == market.offersByPlayer.end()) {
 		return 0;
 	}
-	return result->getNumber<int32_t>("count");
+	return static_cast<uint32_t>(it->second.size());
 }
 
 MarketOfferEx IOMarket::getOfferByCounter(uint32_t timestamp, uint16_t counter) {
@@ -257,114 +349,153 @@ MarketOfferEx IOMarket::getOfferByCounter(uint32_t timestamp, uint16_t counter)
 
 	const int32_t created = timestamp - g_configManager().getNumber(MARKET_OFFER_DURATION, __FUNCTION__);
 
-	std::ostringstream query;
-	query << "SELECT `id`, `sale`, `itemtype`, `amount`, `created`, `price`, `player_id`, `anonymous`, `tier`, (SELECT `name` FROM `players` WHERE `id` = `player_id`) AS `player_name` FROM `market_offers` WHERE `created` = " << created << " AND (`id` & 65535) = " << counter << " LIMIT 1";
-
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
+	const auto &market = getInstance();
+	const auto it = market.offersByCounter.find(getCounterKey(created, counter));
+	if (it == market.offersByCounter.end()) {
 		offer.id = 0;
 		return offer;
 	}
 
-	offer.id = result->getNumber<uint32_t>("id");
-	offer.type = static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale"));
-	offer.amount = result->getNumber<uint16_t>("amount");
-	offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-	offer.timestamp = result->getNumber<uint32_t>("created");
-	offer.price = result->getNumber<uint64_t>("price");
-	offer.itemId = result->getNumber<uint16_t>("itemtype");
-	offer.playerId = result->getNumber<uint32_t>("player_id");
-	offer.tier = getTierFromDatabaseTable(result->getString("tier"));
-	if (result->getNumber<uint16_t>("anonymous") == 0) {
-		offer.playerName = result->getString("player_name");
-	} else {
-		offer.playerName = "Anonymous";
-	}
+	const auto &activeOffer = market.offers.at(it->second);
+	offer.id = activeOffer.id;
+	offer.type = activeOffer.type;
+	offer.amount = activeOffer.amount;
+	offer.counter = activeOffer.id & 0xFFFF;
+	offer.timestamp = activeOffer.created;
+	offer.price = activeOffer.price;
+	offer.itemId = activeOffer.itemId;
+	offer.playerId = activeOffer.playerId;
+	offer.tier = activeOffer.tier;
+	offer.playerName = activeOffer.anonymous ? "Anonymous" : activeOffer.playerName;
 	return offer;
 }
 
-void IOMarket::createOffer(uint32_t playerId, MarketAction_t action, uint32_t itemId, uint16_t amount, uint64_t price, uint8_t tier, bool anonymous) {
+void IOMarket::createOffer(uint32_t playerId, const std::string &playerName, MarketAction_t action, uint32_t itemId, uint16_t amount, uint64_t price, uint8_t tier, bool anonymous) {
+	auto &market = getInstance();
+
+	ActiveMarketOffer offer;
+	offer.id = market.nextOfferId++;
+	offer.playerId = playerId;
+	offer.created = static_cast<uint32_t>(getTimeNow());
+	offer.price = price;
+	offer.amount = amount;
+	offer.itemId = static_cast<uint16_t>(itemId);
+	offer.tier = tier;
+	offer.type = action;
+	offer.anonymous = anonymous;
+	offer.playerName = playerName;
+
 	std::ostringstream query;
-	query << "INSERT INTO `market_offers` (`player_id`, `sale`, `itemtype`, `amount`, `created`, `anonymous`, `price`, `tier`) VALUES (" << playerId << ',' << action << ',' << itemId << ',' << amount << ',' << getTimeNow() << ',' << anonymous << ',' << price << ',' << std::to_string(tier) << ')';
-	Database::getInstance().executeQuery(query.str());
+	query << "INSERT INTO `market_offers` (`id`, `player_id`, `sale`, `itemtype`, `amount`, `created`, `anonymous`, `price`, `tier`) VALUES (" << offer.id << ',' << playerId << ',' << action << ',' << itemId << ',' << amount << ',' << offer.created << ',' << anonymous << ',' << price << ',' << std::to_string(tier) << ')';
+	market.addOffer(std::move(offer));
+	market.persist(query.str());
 }
 
 void IOMarket::acceptOffer(uint32_t offerId, uint16_t amount) {
+	auto &market = getInstance();
+	const auto it = market.offers.find(offerId);
+	if (it != market.offers.end()) {
+		it->second.amount -= std::min(it->second.amount, amount);
+	}
+
 	std::ostringstream query;
 	query << "UPDATE `market_offers` SET `amount` = `amount` - " << amount << " WHERE `id` = " << offerId;
-	Database::getInstance().executeQuery(query.str());
+	market.persist(query.str());
 }
 
 void IOMarket::deleteOffer(uint32_t offerId) {
+	auto &market = getInstance();
+	market.removeOffer(offerId);
+
 	std::ostringstream query;
 	query << "DELETE FROM `market_offers` WHERE `id` = " << offerId;
-	Database::getInstance().executeQuery(query.str());
+	market.persist(query.str());
+}
+
+void IOMarket::updatePlayerName(uint32_t playerId, const std::string &playerName) {
+	auto &market = getInstance();
+	const auto it = market.offersByPlayer.find(playerId);
+	if (it == market.offersByPlayer.end()) {
+		return;
+	}
+
+	for (const uint32_t offerId : it->second) {
+		if (const auto offerIt = market.offers.find(offerId); offerIt != market.offers.end()) {
+			offerIt->second.playerName = playerName;
+		}
+	}
 }
 
 void IOMarket::appendHistory(uint32_t playerId, MarketAction_t type, uint16_t itemId, uint16_t amount, uint64_t price, time_t timestamp, uint8_t tier, MarketOfferState_t state) {
+	auto &market = getInstance();
+
+	HistoryMarketOffer offer;
+	offer.timestamp = static_cast<uint32_t>(timestamp);
+	offer.price = price;
+	offer.itemId = itemId;
+	offer.amount = amount;
+	offer.tier = tier;
+	offer.state = state;
+	market.addHistory(playerId, type, offer);
+	if (state == OFFERSTATE_ACCEPTED) {
+		market.addStatistics(type, itemId, tier, price);
+	}
+
 	std::ostringstream query;
 	query << "INSERT INTO `market_history` (`player_id`, `sale`, `itemtype`, `amount`, `price`, `expires_at`, `inserted`, `state`, `tier`) VALUES ("
 		  << playerId << ',' << type << ',' << itemId << ',' << amount << ',' << price << ','
 		  << timestamp << ',' << getTimeNow() << ',' << state << ',' << std::to_string(tier) << ')';
-	g_databaseTasks().execute(query.str());
+	market.persist(query.str());
 }
 
 bool IOMarket::moveOfferToHistory(uint32_t offerId, MarketOfferState_t state) {
-	Database &db = Database::getInstance();
-
-	std::ostringstream query;
-	query << "SELECT `player_id`, `sale`, `itemtype`, `amount`, `price`, `created`, `tier` FROM `market_offers` WHERE `id` = " << offerId;
-
-	DBResult_ptr result = db.storeQuery(query.str());
-	if (!result) {
-		return false;
-	}
-
-	query.str(std::string());
-	query << "DELETE FROM `market_offers` WHERE `id` = " << offerId;
-	if (!db.executeQuery(query.str())) {
+	auto &market = getInstance();
+	const auto it = market.offers.find(offerId);
+	if (it == market.offers.end()) {
 		return false;
 	}
 
-	appendHistory(
-		result->getNumber<uint32_t>("player_id"),
-		static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale")),
-		result->getNumber<uint16_t>("itemtype"),
-		result->getNumber<uint16_t>("amount"),
-		result->getNumber<uint64_t>("price"),
-		getTimeNow(),
-		getTierFromDatabaseTable(result->getString("tier")), state
-	);
+	const ActiveMarketOffer offer = it->second;
+	deleteOffer(offerId);
+	appendHistory(offer.playerId, offer.type, offer.itemId, offer.amount, offer.price, getTimeNow(), offer.tier, state);
 	return true;
 }
 
-void IOMarket::updateStatistics() {
-	auto query = fmt::format(
-		"SELECT sale, itemtype, COUNT(price) AS num, MIN(price) AS min, MAX(price) AS max, SUM(price) AS sum, tier "
-		"FROM market_history "
-		"WHERE state = '{}' "
-		"GROUP BY itemtype, sale, tier",
-		OFFERSTATE_ACCEPTED
-	);
+void IOMarket::loadStatistics() {
+	purchaseStatistics.clear();
+	saleStatistics.clear();
 
-	DBResult_ptr result = g_database().storeQuery(query);
+	DBResult_ptr result = g_database().storeQuery("SELECT `itemtype`, `tier`, `sale`, `transactions`, `lowest_price`, `highest_price`, `total_price` FROM `market_statistics`");
 	if (!result) {
 		return;
 	}
 
 	do {
-		MarketStatistics* statistics = nullptr;
-		const auto tier = getTierFromDatabaseTable(result->getString("tier"));
-		auto itemId = result->getNumber<uint16_t>("itemtype");
-		if (result->getNumber<uint16_t>("sale") == MARKETACTION_BUY) {
-			statistics = &purchaseStatistics[itemId][tier];
-		} else {
-			statistics = &saleStatistics[itemId][tier];
-		}
-
-		statistics->numTransactions = result->getNumber<uint32_t>("num");
-		statistics->lowestPrice = result->getNumber<uint64_t>("min");
-		statistics->totalPrice = result->getNumber<uint64_t>("sum");
-		statistics->highestPrice = result->getNumber<uint64_t>("max");
+		const auto key = getItemTierKey(result->getNumber<uint16_t>("itemtype"), getTierFromDatabaseTable(result->getString("tier")));
+		MarketStatistics &statistics = result->getNumber<uint16_t>("sale") == MARKETACTION_BUY ? purchaseStatistics[key] : saleStatistics[key];
+		statistics.numTransactions = result->getNumber<uint32_t>("transactions");
+		statistics.lowestPrice = result->getNumber<uint64_t>("lowest_price");
+		statistics.totalPrice = result->getNumber<uint64_t>("total_price");
+		statistics.highestPrice = result->getNumber<uint64_t>("highest_price");
 	} while (result->next());
 }
+
+void IOMarket::addStatistics(MarketAction_t type, uint16_t itemId, uint8_t tier, uint64_t price) {
+	const auto key = getItemTierKey(itemId, tier);
+	MarketStatistics &statistics = type == MARKETACTION_BUY ? purchaseStatistics[key] : saleStatistics[key];
+	if (statistics.numTransactions == 0) {
+		statistics.lowestPrice = price;
+		statistics.highestPrice = price;
+	} else {
+		statistics.lowestPrice = std::min(statistics.lowestPrice, price);
+		statistics.highestPrice = std::max(statistics.highestPrice, price);
+	}
+	statistics.totalPrice += price;
+	++statistics.numTransactions;
+
+	persist(fmt::format(
+		"INSERT INTO `market_statistics` (`itemtype`, `tier`, `sale`, `transactions`, `lowest_price`, `highest_price`, `total_price`) VALUES ({0}, {1}, {2}, 1, {3}, {3}, {3}) "
+		"ON DUPLICATE KEY UPDATE `transactions` = `transactions` + 1, `lowest_price` = LEAST(`lowest_price`, {3}), `highest_price` = GREATEST(`highest_price`, {3}), `total_price` = `total_price` + {3}",
+		itemId, tier, static_cast<uint16_t>(type), price
+	));
+}
@@ -13,6 +13,27 @@
 #include "declarations.hpp"
 #include "lib/di/container.hpp"
 
+// An offer of the in-memory order book, mirrors one row of `market_offers`
+struct ActiveMarketOffer {
+	uint32_t id = 0;
+	uint32_t playerId = 0;
+	uint32_t created = 0;
+	uint64_t price = 0;
+	uint16_t amount = 0;
+	uint16_t itemId = 0;
+	uint8_t tier = 0;
+	MarketAction_t type = MARKETACTION_BUY;
+	bool anonymous = false;
+	std::string playerName;
+};
+
+/**
+ * Active offers and the recent history are kept in memory, loaded once by loadOffers,
+ * so browsing the market never waits on the database.
+ * Every change is written through to `market_offers`/`market_history` by a serial
+ * background queue, so the statements reach the database in the order they were made.
+ * The order book is only read and changed from the dispatcher thread.
+ */
 class IOMarket {
 public:
 	IOMarket() = default;
@@ -26,33 +47,86 @@ public:
 	static MarketOfferList getOwnOffers(MarketAction_t action, uint32_t playerId);
 	static HistoryMarketOfferList getOwnHistory(MarketAction_t action, uint32_t playerId);
 
-	static void processExpiredOffers(DBResult_ptr result, bool);
+	void loadOffers();
+
+	static void processExpiredOffers();
 	static void checkExpiredOffers();
 
 	static uint32_t getPlayerOfferCount(uint32_t playerId);
 	static MarketOfferEx getOfferByCounter(uint32_t timestamp, uint16_t counter);
 
-	static void createOffer(uint32_t playerId, MarketAction_t action, uint32_t itemId, uint16_t amount, uint64_t price, uint8_t tier, bool anonymous);
+	static void createOffer(uint32_t playerId, const std::string &playerName, MarketAction_t action, uint32_t itemId, uint16_t amount, uint64_t price, uint8_t tier, bool anonymous);
 	static void acceptOffer(uint32_t offerId, uint16_t amount);
 	static void deleteOffer(uint32_t offerId);
 
+	// Offers keep the owner name they were created or loaded with, this refreshes it after a rename
+	static void updatePlayerName(uint32_t playerId, const std::string &playerName);
+
 	static void appendHistory(uint32_t playerId, MarketAction_t type, uint16_t itemId, uint16_t amount, uint64_t price, time_t timestamp, uint8_t tier, MarketOfferState_t state);
 	static bool moveOfferToHistory(uint32_t offerId, MarketOfferState_t state);
 
-	void updateStatistics();
+	// Loads the running aggregates of `market_statistics`, kept up to date by appendHistory afterwards
+	void loadStatistics();
+
+	// Single level key of an item id and tier, used by the statistics and the items price map
+	static uint32_t getItemTierKey(uint16_t itemId, uint8_t tier) {
+		return (static_cast<uint32_t>(itemId) << 8) | tier;
+	}
 
-	using StatisticsMap = std::map<uint16_t, std::map<uint8_t, MarketStatistics>>;
+	// [uint32_t = getItemTierKey, MarketStatistics = structure of the statistics]
+	using StatisticsMap = phmap::flat_hash_map<uint32_t, MarketStatistics>;
 	const StatisticsMap &getPurchaseStatistics() const {
 		return purchaseStatistics;
 	}
 	const StatisticsMap &getSaleStatistics() const {
 		return saleStatistics;
 	}
+	const MarketStatistics* getPurchaseStatistics(uint16_t itemId, uint8_t tier) const {
+		const auto it = purchaseStatistics.find(getItemTierKey(itemId, tier));
+		return it != purchaseStatistics.end() ? &it->second : nullptr;
+	}
+	const MarketStatistics* getSaleStatistics(uint16_t itemId, uint8_t tier) const {
+		const auto it = saleStatistics.find(getItemTierKey(itemId, tier));
+		return it != saleStatistics.end() ? &it->second : nullptr;
+	}
 
 	static uint8_t getTierFromDatabaseTable(const std::string &string);
 
+	// Blocks until every queued write reached the database
+	void flushWrites();
+
 private:
-	// [uint16_t = item id, [uint8_t = item tier, MarketStatistics = structure of the statistics]]
+	static uint32_t getBookKey(uint16_t itemId, uint8_t tier, MarketAction_t action) {
+		return (static_cast<uint32_t>(itemId) << 16) | (static_cast<uint32_t>(tier) << 8) | static_cast<uint32_t>(action);
+	}
+	static uint64_t getCounterKey(uint32_t created, uint16_t counter) {
+		return (static_cast<uint64_t>(created) << 16) | counter;
+	}
+
+	void addOffer(ActiveMarketOffer offer);
+	void removeOffer(uint32_t offerId);
+	void addHistory(uint32_t playerId, MarketAction_t type, HistoryMarketOffer offer);
+	void addStatistics(MarketAction_t type, uint16_t itemId, uint8_t tier, uint64_t price);
+
+	void persist(std::string query);
+	void drainWrites();
+
+	// [uint32_t = offer id, ActiveMarketOffer = the offer]
+	phmap::flat_hash_map<uint32_t, ActiveMarketOffer> offers;
+	// Offer ids (in creation order) by item id, tier and side, see getBookKey
+	phmap::flat_hash_map<uint32_t, phmap::btree_set<uint32_t>> offersByItem;
+	phmap::flat_hash_map<uint32_t, phmap::btree_set<uint32_t>> offersByPlayer;
+	// The client identifies an offer by its creation time and the lower 16 bits of its id, see getCounterKey
+	phmap::flat_hash_map<uint64_t, uint32_t> offersByCounter;
+	// [uint32_t = player id, [MarketAction_t = side, history of that side]]
+	phmap::flat_hash_map<uint32_t, std::array<HistoryMarketOfferList, 2>> historyByPlayer;
+	uint32_t nextOfferId = 1;
+
+	std::mutex writeMutex;
+	std::condition_variable writesDone;
+	std::deque<std::string> pendingWrites;
+	bool writing = false;
+
 	StatisticsMap purchaseStatistics;
 	StatisticsMap saleStatistics;
 };
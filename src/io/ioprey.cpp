@@ -63,7 +63,7 @@ void PreySlot::reloadMonsterGrid(std::vector<uint16_t> blackList, uint32_t level
 	// Disabling prey system if the server have less then 36 registered monsters on bestiary because:
 	// - Impossible to generate random lists without duplications on slots.
 	// - Stress the server with unnecessary loops.
-	std::map<uint16_t, std::string> bestiary = g_game().getBestiaryList();
+	const auto &bestiary = g_game().getBestiaryList();
 	if (bestiary.size() < 36) {
 		return;
 	}
@@ -144,7 +144,7 @@ void TaskHuntingSlot::reloadMonsterGrid(std::vector<uint16_t> blackList, uint32_
 	// Disabling task hunting system if the server have less then 36 registered monsters on bestiary because:
 	// - Impossible to generate random lists without duplications on slots.
 	// - Stress the server with unnecessary loops.
-	std::map<uint16_t, std::string> bestiary = g_game().getBestiaryList();
+	const auto &bestiary = g_game().getBestiaryList();
 	if (bestiary.size() < 36) {
 		return;
 	}
@@ -568,9 +568,9 @@ void IOPrey::initializeTaskHuntOptions() {
 	}
 
 	msg.addByte(0xBA);
-	std::map<uint16_t, std::string> bestiaryList = g_game().getBestiaryList();
+	const auto &bestiaryList = g_game().getBestiaryList();
 	msg.add<uint16_t>(static_cast<uint16_t>(bestiaryList.size()));
-	std::for_each(bestiaryList.begin(), bestiaryList.end(), [&msg](auto mType) {
+	std::for_each(bestiaryList.begin(), bestiaryList.end(), [&msg](const auto &mType) {
 		const auto mtype = g_monsters().getMonsterType(mType.second);
 		if (!mtype) {
 			return;
@@ -375,6 +375,7 @@ void Tile::onAddTileItem(std::shared_ptr<Item> item) {
 	}
 
 	setTileFlags(item);
+	resetItemsDescription();
 
 	const Position &cylinderMapPos = getPosition();
 
@@ -436,6 +437,8 @@ void Tile::onAddTileItem(std::shared_ptr<Item> item) {
 }
 
 void Tile::onUpdateTileItem(std::shared_ptr<Item> oldItem, const ItemType &oldType, std::shared_ptr<Item> newItem, const ItemType &newType) {
+	resetItemsDescription();
+
 	if ((newItem->hasProperty(CONST_PROP_MOVABLE) || newItem->getContainer()) || (newItem->isWrapable() && newItem->hasProperty(CONST_PROP_MOVABLE) && !oldItem->hasProperty(CONST_PROP_BLOCKPATH))) {
 		auto it = g_game().browseFields.find(getTile());
 		if (it != g_game().browseFields.end()) {
@@ -478,6 +481,8 @@ void Tile::onUpdateTileItem(std::shared_ptr<Item> oldItem, const ItemType &oldTy
 }
 
 void Tile::onRemoveTileItem(const CreatureVector &spectators, const std::vector<int32_t> &oldStackPosVector, std::shared_ptr<Item> item) {
+	resetItemsDescription();
+
 	if ((item->hasProperty(CONST_PROP_MOVABLE) || item->getContainer()) || (item->isWrapable() && !item->hasProperty(CONST_PROP_MOVABLE) && !item->hasProperty(CONST_PROP_BLOCKPATH))) {
 		auto it = g_game().browseFields.find(getTile());
 		if (it != g_game().browseFields.end()) {
@@ -561,6 +566,8 @@ void Tile::onRemoveTileItem(const CreatureVector &spectators, const std::vector<
 }
 
 void Tile::onUpdateTile(const CreatureVector &spectators) {
+	resetItemsDescription();
+
 	const Position &cylinderMapPos = getPosition();
 
 	// send to clients
@@ -569,6 +576,43 @@ void Tile::onUpdateTile(const CreatureVector &spectators) {
 	}
 }
 
+const std::string* Tile::getItemsDescription(bool oldProtocol) const {
+	if (!itemsDescription || !itemsDescription->valid[oldProtocol]) {
+		return nullptr;
+	}
+	return &itemsDescription->bytes[oldProtocol];
+}
+
+void Tile::setItemsDescription(bool oldProtocol, std::string description) {
+	if (!itemsDescription) {
+		itemsDescription = std::make_unique<ItemsDescription>();
+	}
+	itemsDescription->bytes[oldProtocol] = std::move(description);
+	itemsDescription->valid[oldProtocol] = true;
+}
+
+bool Tile::canCacheItemsDescription() const {
+	// Items whose client encoding changes without passing through the tile
+	// (running timers, charges, podium outfits and tiers) are always encoded live
+	const auto isCacheable = [](const std::shared_ptr<Item> &item) {
+		const ItemType &it = Item::items[item->getID()];
+		return !(it.expire || it.expireStop || it.clockExpire || it.wearOut || it.isPodium || item->getClassification() > 0);
+	};
+
+	if (ground && !isCacheable(ground)) {
+		return false;
+	}
+
+	if (const TileItemVector* items = getItemList()) {
+		for (const auto &item : *items) {
+			if (!isCacheable(item)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
 ReturnValue Tile::queryAdd(int32_t, const std::shared_ptr<Thing> &thing, uint32_t, uint32_t tileFlags, std::shared_ptr<Creature>) {
 	if (hasBitSet(FLAG_NOLIMIT, tileFlags)) {
 		return RETURNVALUE_NOERROR;
@@ -1575,6 +1619,7 @@ void Tile::internalAddThing(uint32_t, std::shared_ptr<Thing> thing) {
 	if (!thing) {
 		return;
 	}
+	resetItemsDescription();
 	for (const auto &zone : getZones()) {
 		zone->thingAdded(thing);
 	}
@@ -1704,6 +1749,7 @@ void Tile::setTileFlags(const std::shared_ptr<Item> &item) {
 
 	if (item->hasProperty(CONST_PROP_BLOCKPROJECTILE)) {
 		setFlag(TILESTATE_BLOCKPROJECTILE);
+		g_game().map.setProjectileBlocked(tilePos, true);
 	}
 
 	if (item->hasProperty(CONST_PROP_HASHEIGHT)) {
@@ -1765,6 +1811,7 @@ void Tile::resetTileFlags(const std::shared_ptr<Item> &item) {
 
 	if (item->hasProperty(CONST_PROP_BLOCKPROJECTILE) && !hasProperty(item, CONST_PROP_BLOCKPROJECTILE)) {
 		resetFlag(TILESTATE_BLOCKPROJECTILE);
+		g_game().map.setProjectileBlocked(tilePos, false);
 	}
 
 	if (item->hasProperty(CONST_PROP_HASHEIGHT) && !hasProperty(item, CONST_PROP_HASHEIGHT)) {
@@ -259,8 +259,21 @@ public:
 		if (ground = item) {
 			setTileFlags(item);
 		}
+		resetItemsDescription();
 	}
 
+	/**
+	 * Client encoding of the item stack (ground, top and down items) kept per protocol
+	 * version, so every spectator describing a tile without creatures reuses the same bytes.
+	 * It is dropped whenever an item on the tile changes.
+	 */
+	const std::string* getItemsDescription(bool oldProtocol) const;
+	void setItemsDescription(bool oldProtocol, std::string description);
+	void resetItemsDescription() {
+		itemsDescription.reset();
+	}
+	bool canCacheItemsDescription() const;
+
 private:
 	void onAddTileItem(std::shared_ptr<Item> item);
 	void onUpdateTileItem(std::shared_ptr<Item> oldItem, const ItemType &oldType, std::shared_ptr<Item> newItem, const ItemType &newType);
@@ -272,11 +285,17 @@ private:
 	bool hasHarmfulField() const;
 	ReturnValue checkNpcCanWalkIntoTile() const;
 
+	struct ItemsDescription {
+		std::string bytes[2];
+		bool valid[2] = { false, false };
+	};
+
 protected:
 	std::shared_ptr<Item> ground = nullptr;
 	Position tilePos;
 	uint32_t flags = 0;
 	std::unordered_set<std::shared_ptr<Zone>> zones;
+	std::unique_ptr<ItemsDescription> itemsDescription;
 };
 
 // Used for walkable tiles, where there is high likeliness of
@@ -35,7 +35,7 @@ void KVStore::set(const std::string &key, const ValueWrapper &value) {
 	return setLocked(key, value);
 }
 
-void KVStore::setLocked(const std::string &key, const ValueWrapper &value) {
+void KVStore::setLocked(const std::string &key, const ValueWrapper &value, bool dirty /* = true*/) {
 	logger.trace("KVStore::set({})", key);
 	auto it = store_.find(key);
 	if (it != store_.end()) {
@@ -46,7 +46,10 @@ void KVStore::setLocked(const std::string &key, const ValueWrapper &value) {
 			logger.debug("KVStore::set() - MAX_SIZE reached, removing last element");
 			auto last = lruQueue_.end();
 			last--;
-			save(*last, store_[*last].first);
+			// Clean entries already match the backend, only pending writes need to reach it before eviction
+			if (dirtyKeys_.erase(*last) > 0) {
+				save(*last, store_[*last].first);
+			}
 			store_.erase(*last);
 			lruQueue_.pop_back();
 		}
@@ -54,6 +57,10 @@ void KVStore::setLocked(const std::string &key, const ValueWrapper &value) {
 		lruQueue_.push_front(key);
 		store_.try_emplace(key, std::make_pair(value, lruQueue_.begin()));
 	}
+
+	if (dirty) {
+		dirtyKeys_.insert(key);
+	}
 }
 
 std::optional<ValueWrapper> KVStore::get(const std::string &key, bool forceLoad /*= false */) {
@@ -62,7 +69,7 @@ std::optional<ValueWrapper> KVStore::get(const std::string &key, bool forceLoad
 	if (forceLoad || !store_.contains(key)) {
 		auto value = load(key);
 		if (value) {
-			setLocked(key, *value);
+			setLocked(key, *value, false);
 		}
 		return value;
 	}
@@ -18,6 +18,7 @@
 	#include <unordered_set>
 	#include <iomanip>
 	#include <list>
+	#include <atomic>
 #endif
 
 #include "lib/logging/logger.hpp"
@@ -86,35 +87,70 @@ public:
 	std::optional<ValueWrapper> get(const std::string &key, bool forceLoad = false) override;
 
 	void flush() override {
-		std::scoped_lock lock(mutex_);
 		KV::flush();
+		std::scoped_lock lock(mutex_);
 		store_.clear();
+		lruQueue_.clear();
+		dirtyKeys_.clear();
 	}
 
 	std::shared_ptr<KV> scoped(const std::string &scope) override final;
 	std::unordered_set<std::string> keys(const std::string &prefix = "");
 
+	size_t dirtySize() {
+		std::scoped_lock lock(mutex_);
+		return dirtyKeys_.size();
+	}
+
+	/**
+	 * @brief Number of keys written to the backend by the last saveAll call.
+	 */
+	size_t lastFlushedKeys() const {
+		return lastFlushedKeys_;
+	}
+
 protected:
-	phmap::parallel_flat_hash_map<std::string, std::pair<ValueWrapper, std::list<std::string>::iterator>> getStore() {
+	/**
+	 * @brief Takes a snapshot of every key modified since the last successful flush.
+	 * @details The dirty set is cleared; if persisting the snapshot fails the caller
+	 * must hand the keys back through markDirty so they are retried on the next save.
+	 */
+	std::vector<std::pair<std::string, ValueWrapper>> takeDirty() {
+		std::scoped_lock lock(mutex_);
+		std::vector<std::pair<std::string, ValueWrapper>> dirty;
+		dirty.reserve(dirtyKeys_.size());
+		for (const auto &key : dirtyKeys_) {
+			auto it = store_.find(key);
+			if (it != store_.end()) {
+				dirty.emplace_back(key, it->second.first);
+			}
+		}
+		dirtyKeys_.clear();
+		return dirty;
+	}
+
+	void markDirty(const std::vector<std::pair<std::string, ValueWrapper>> &entries) {
 		std::scoped_lock lock(mutex_);
-		phmap::parallel_flat_hash_map<std::string, std::pair<ValueWrapper, std::list<std::string>::iterator>> copy;
-		for (const auto &[key, value] : store_) {
-			copy.try_emplace(key, value);
+		for (const auto &[key, value] : entries) {
+			if (store_.contains(key)) {
+				dirtyKeys_.insert(key);
+			}
 		}
-		return copy;
 	}
 
 protected:
 	Logger &logger;
+	std::atomic<size_t> lastFlushedKeys_ = 0;
 
 	virtual std::optional<ValueWrapper> load(const std::string &key) = 0;
 	virtual bool save(const std::string &key, const ValueWrapper &value) = 0;
 	virtual std::vector<std::string> loadPrefix(const std::string &prefix = "") = 0;
 
 private:
-	void setLocked(const std::string &key, const ValueWrapper &value);
+	void setLocked(const std::string &key, const ValueWrapper &value, bool dirty = true);
 
 	phmap::parallel_flat_hash_map<std::string, std::pair<ValueWrapper, std::list<std::string>::iterator>> store_;
+	phmap::flat_hash_set<std::string> dirtyKeys_;
 	std::list<std::string> lruQueue_;
 	std::mutex mutex_;
 };
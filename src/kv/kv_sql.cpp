@@ -59,41 +59,76 @@ std::vector<std::string> KVSQL::loadPrefix(const std::string &prefix /* = ""*/)
 
 bool KVSQL::save(const std::string &key, const ValueWrapper &value) {
 	auto update = dbUpdate();
-	prepareSave(key, value, update);
-	return update.execute();
+	std::vector<std::string> deletedKeys;
+	if (!prepareSave(key, value, update, deletedKeys)) {
+		return false;
+	}
+	return executeDeletes(deletedKeys) && update.execute();
 }
 
-bool KVSQL::prepareSave(const std::string &key, const ValueWrapper &value, DBInsert &update) {
+bool KVSQL::prepareSave(const std::string &key, const ValueWrapper &value, DBInsert &update, std::vector<std::string> &deletedKeys) {
+	if (value.isDeleted()) {
+		deletedKeys.emplace_back(db.escapeString(key));
+		return true;
+	}
+
 	auto protoValue = ProtoSerializable::toProto(value);
 	std::string data;
 	if (!protoValue.SerializeToString(&data)) {
 		return false;
 	}
-	if (value.isDeleted()) {
-		auto query = fmt::format("DELETE FROM `kv_store` WHERE `key_name` = {}", db.escapeString(key));
-		return db.executeQuery(query);
-	}
 
 	update.addRow(fmt::format("{}, {}, {}", db.escapeString(key), value.getTimestamp(), db.escapeString(data)));
 	return true;
 }
 
+bool KVSQL::executeDeletes(const std::vector<std::string> &deletedKeys) {
+	if (deletedKeys.empty()) {
+		return true;
+	}
+
+	// Keys are already escaped, keep each statement well below the max query size
+	static constexpr size_t maxKeysPerQuery = 1000;
+	for (size_t offset = 0; offset < deletedKeys.size(); offset += maxKeysPerQuery) {
+		auto last = std::min(deletedKeys.size(), offset + maxKeysPerQuery);
+		auto query = fmt::format("DELETE FROM `kv_store` WHERE `key_name` IN ({})", fmt::join(deletedKeys.begin() + offset, deletedKeys.begin() + last, ", "));
+		if (!db.executeQuery(query)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 bool KVSQL::saveAll() {
-	auto store = getStore();
-	bool success = DBTransaction::executeWithinTransaction([this, &store]() {
+	std::scoped_lock lock(flushMutex_);
+	auto dirty = takeDirty();
+	if (dirty.empty()) {
+		lastFlushedKeys_ = 0;
+		logger.debug("[{}] No dirty keys to flush", __FUNCTION__);
+		return true;
+	}
+
+	std::vector<std::string> deletedKeys;
+	bool success = DBTransaction::executeWithinTransaction([this, &dirty, &deletedKeys]() {
 		auto update = dbUpdate();
-		if (!std::ranges::all_of(store, [this, &update](const auto &kv) {
+		if (!std::ranges::all_of(dirty, [this, &update, &deletedKeys](const auto &kv) {
 				const auto &[key, value] = kv;
-				return prepareSave(key, value.first, update);
+				return prepareSave(key, value, update, deletedKeys);
 			})) {
 			return false;
 		}
-		return update.execute();
+		return executeDeletes(deletedKeys) && update.execute();
 	});
 
 	if (!success) {
-		g_logger().error("[{}] Error occurred saving player", __FUNCTION__);
+		// Hand the snapshot back so the next save retries it
+		markDirty(dirty);
+		lastFlushedKeys_ = 0;
+		logger.error("[{}] Error occurred saving key-value store, {} keys kept dirty", __FUNCTION__, dirty.size());
+		return false;
 	}
 
-	return success;
+	lastFlushedKeys_ = dirty.size();
+	logger.debug("[{}] Flushed {} keys ({} upserted, {} deleted)", __FUNCTION__, dirty.size(), dirty.size() - deletedKeys.size(), deletedKeys.size());
+	return true;
 }
@@ -28,7 +28,8 @@ private:
 	std::vector<std::string> loadPrefix(const std::string &prefix = "") override;
 	std::optional<ValueWrapper> load(const std::string &key) override;
 	bool save(const std::string &key, const ValueWrapper &value) override;
-	bool prepareSave(const std::string &key, const ValueWrapper &value, DBInsert &update);
+	bool prepareSave(const std::string &key, const ValueWrapper &value, DBInsert &update, std::vector<std::string> &deletedKeys);
+	bool executeDeletes(const std::vector<std::string> &deletedKeys);
 
 	DBInsert dbUpdate() {
 		auto insert = DBInsert("INSERT INTO `kv_store` (`key_name`, `timestamp`, `value`) VALUES");
@@ -37,4 +38,5 @@ private:
 	}
 
 	Database &db;
+	std::mutex flushMutex_;
 };
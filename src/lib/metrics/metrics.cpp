@@ -13,10 +13,133 @@
 
 using namespace metrics;
 
+namespace metrics {
+	// Owns the calling thread's shard, registered on first use and folded into the retired values when the thread exits
+	struct ThreadShard {
+		ThreadShard() {
+			g_metrics().registerShard(&shard);
+		}
+
+		~ThreadShard() {
+			g_metrics().retireShard(&shard);
+		}
+
+		ThreadShard(const ThreadShard &) = delete;
+		ThreadShard &operator=(const ThreadShard &) = delete;
+
+		MetricShard shard;
+	};
+}
+
 Metrics &Metrics::getInstance() {
 	return inject<Metrics>();
 }
 
+MetricShard &Metrics::getThreadShard() {
+	thread_local ThreadShard threadShard;
+	return threadShard.shard;
+}
+
+void Metrics::registerShard(MetricShard* shard) {
+	std::scoped_lock lock(shardsMutex_);
+	shards.emplace_back(shard);
+}
+
+void Metrics::retireShard(MetricShard* shard) {
+	std::scoped_lock lock(shardsMutex_);
+	for (uint32_t id = 0; id < retiredValues.size(); ++id) {
+		retiredValues[id] += shard->values[id].load(std::memory_order_relaxed);
+	}
+	std::erase(shards, shard);
+}
+
+CounterHandle Metrics::counter(std::string_view name, std::map<std::string, std::string> attrs) {
+	return CounterHandle(registerSeries(name, std::move(attrs), false));
+}
+
+UpDownCounterHandle Metrics::upDownCounter(std::string_view name, std::map<std::string, std::string> attrs) {
+	return UpDownCounterHandle(registerSeries(name, std::move(attrs), true));
+}
+
+uint32_t Metrics::registerSeries(std::string_view name, std::map<std::string, std::string> attrs, bool upDown) {
+	uint32_t id;
+	{
+		std::scoped_lock lock(shardsMutex_);
+		auto &instrument = shardedInstruments[std::string(name)];
+		if (instrument.name.empty()) {
+			instrument.name = std::string(name);
+			instrument.upDown = upDown;
+		}
+
+		for (const auto seriesId : instrument.series) {
+			if (seriesAttributes[seriesId] == attrs) {
+				return seriesId;
+			}
+		}
+
+		if (seriesAttributes.size() >= MAX_SHARDED_SERIES) {
+			g_logger().error("[{}] - Can not register metric {}, all {} series are in use", __FUNCTION__, name, MAX_SHARDED_SERIES);
+			return INVALID_SERIES;
+		}
+
+		id = static_cast<uint32_t>(seriesAttributes.size());
+		seriesAttributes.emplace_back(std::move(attrs));
+		retiredValues.emplace_back(0.0);
+		instrument.series.emplace_back(id);
+	}
+
+	createObservableInstruments();
+	return id;
+}
+
+void Metrics::createObservableInstruments() {
+	std::scoped_lock observablesLock(observablesMutex_);
+	auto meter = getMeter();
+	if (!meter) {
+		return;
+	}
+
+	std::vector<ShardedInstrument*> pending;
+	{
+		std::scoped_lock lock(shardsMutex_);
+		for (auto &[name, instrument] : shardedInstruments) {
+			if (!instrument.observable) {
+				pending.emplace_back(&instrument);
+			}
+		}
+	}
+
+	for (auto* instrument : pending) {
+		if (instrument->upDown) {
+			instrument->observable = meter->CreateInt64ObservableUpDownCounter(instrument->name);
+		} else {
+			instrument->observable = meter->CreateDoubleObservableCounter(instrument->name);
+		}
+		instrument->observable->AddCallback(&Metrics::observeInstrument, instrument);
+	}
+}
+
+void Metrics::observeInstrument(metrics_api::ObserverResult result, void* state) {
+	const auto* instrument = static_cast<const ShardedInstrument*>(state);
+	auto &metrics = g_metrics();
+
+	std::scoped_lock lock(metrics.shardsMutex_);
+	for (const auto id : instrument->series) {
+		double total = metrics.retiredValues[id];
+		for (const auto* shard : metrics.shards) {
+			total += shard->values[id].load(std::memory_order_relaxed);
+		}
+
+		const auto &attrs = metrics.seriesAttributes[id];
+		auto attrskv = opentelemetry::common::KeyValueIterableView<std::map<std::string, std::string>> { attrs };
+		if (instrument->upDown) {
+			opentelemetry::nostd::get<opentelemetry::nostd::shared_ptr<metrics_api::ObserverResultT<int64_t>>>(result)->Observe(static_cast<int64_t>(total), attrskv);
+		} else {
+			opentelemetry::nostd::get<opentelemetry::nostd::shared_ptr<metrics_api::ObserverResultT<double>>>(result)->Observe(total, attrskv);
+		}
+	}
+}
+
 void Metrics::init(Options opts) {
 	if (!opts.enableOStreamExporter && !opts.enablePrometheusExporter) {
 		return;
@@ -40,6 +163,8 @@ void Metrics::init(Options opts) {
 
 	metrics_api::Provider::SetMeterProvider(std::move(provider));
 	initHistograms();
+	// Handles registered before the provider existed
+	createObservableInstruments();
 }
 
 void Metrics::initHistograms() {
@@ -87,11 +212,58 @@ void Metrics::shutdown() {
 	metrics_api::Provider::SetMeterProvider(none);
 }
 
-ScopedLatency::ScopedLatency(const std::string_view &name, const std::string &histogramName, const std::string &scopeKey) :
-	ScopedLatency(name, g_metrics().latencyHistograms[histogramName], { { scopeKey, std::string(name) } }, g_metrics().defaultContext) {
+metrics_api::Histogram<double>* Metrics::getLatencyHistogram(std::string_view histogramName) {
+	const auto histogramIt = latencyHistograms.find(std::string(histogramName));
+	if (histogramIt == latencyHistograms.end()) {
+		return nullptr;
+	}
+	return histogramIt->second.get();
+}
+
+const LatencySeries* Metrics::getLatencySeries(std::string_view histogramName, std::string_view scopeKey, std::string_view name) {
+	// Reused key buffer, a cached scope is found without allocating
+	thread_local std::string key;
+	thread_local phmap::flat_hash_map<std::string, const LatencySeries*> cache;
+
+	key.assign(histogramName);
+	key += '|';
+	key += name;
+	if (const auto it = cache.find(key); it != cache.end()) {
+		return it->second;
+	}
+
+	const auto histogram = getLatencyHistogram(histogramName);
 	if (histogram == nullptr) {
+		// Not initialized (yet), not cached so the scope is measured once the histograms exist
+		return nullptr;
+	}
+
+	const LatencySeries* series;
+	{
+		std::scoped_lock lock(latencyMutex_);
+		auto &entry = latencySeries[key];
+		if (entry.histogram == nullptr) {
+			entry.histogram = histogram;
+			entry.attrs = { { std::string(scopeKey), std::string(name) } };
+		}
+		series = &entry;
+	}
+	cache.emplace(key, series);
+	return series;
+}
+
+ScopedLatency::ScopedLatency(std::string_view name, std::string_view histogramName, std::string_view scopeKey, bool cached) :
+	begin(std::chrono::steady_clock::now()) {
+	if (cached) {
+		series = g_metrics().getLatencySeries(histogramName, scopeKey, name);
+	} else if (const auto histogram = g_metrics().getLatencyHistogram(histogramName)) {
+		ownSeries.histogram = histogram;
+		ownSeries.attrs = { { std::string(scopeKey), std::string(name) } };
+		series = &ownSeries;
+	}
+
+	if (series == nullptr) {
 		stopped = true;
-		return;
 	}
 }
 
@@ -106,8 +278,8 @@ void ScopedLatency::stop() {
 	stopped = true;
 	auto end = std::chrono::steady_clock::now();
 	double elapsed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / 1000;
-	auto attrskv = opentelemetry::common::KeyValueIterableView<decltype(attrs)> { attrs };
-	histogram->Record(elapsed, attrskv, context);
+	auto attrskv = opentelemetry::common::KeyValueIterableView<std::map<std::string, std::string>> { series->attrs };
+	series->histogram->Record(elapsed, attrskv, g_metrics().defaultContext);
 }
 
 #endif // FEATURE_METRICS
@@ -52,12 +52,70 @@ namespace metrics {
 		metrics_exporter::PrometheusExporterOptions prometheusOptions;
 	};
 
+	// Max number of pre-registered counter series, every thread keeps one slot per series
+	static constexpr uint32_t MAX_SHARDED_SERIES = 1024;
+	static constexpr uint32_t INVALID_SERIES = std::numeric_limits<uint32_t>::max();
+
+	// Per-thread values of the pre-registered series, written only by the owning thread and summed at export
+	struct MetricShard {
+		std::array<std::atomic<double>, MAX_SHARDED_SERIES> values {};
+
+		void add(uint32_t id, double value) {
+			auto &slot = values[id];
+			slot.store(slot.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+		}
+	};
+
+	/**
+	 * Handle to a counter series registered once with a fixed attribute set, see Metrics::counter.
+	 * add() is a plain add to a thread-local slot: no lock, no lookup and no attribute map.
+	 */
+	class CounterHandle {
+	public:
+		CounterHandle() = default;
+
+		void add(double value) const;
+
+	private:
+		friend class Metrics;
+		explicit CounterHandle(uint32_t id) :
+			id(id) { }
+
+		uint32_t id = INVALID_SERIES;
+	};
+
+	// Same as CounterHandle, for up/down counters (see Metrics::upDownCounter)
+	class UpDownCounterHandle {
+	public:
+		UpDownCounterHandle() = default;
+
+		void add(int64_t value) const;
+
+	private:
+		friend class Metrics;
+		explicit UpDownCounterHandle(uint32_t id) :
+			id(id) { }
+
+		uint32_t id = INVALID_SERIES;
+	};
+
+	// A latency histogram with its attribute set, built on the first measurement of a scope name (cached scopes only)
+	struct LatencySeries {
+		metrics_api::Histogram<double>* histogram = nullptr;
+		std::map<std::string, std::string> attrs;
+	};
+
 	class ScopedLatency {
 	public:
-		explicit ScopedLatency(const std::string_view &name, const std::string &histogramName, const std::string &scopeKey);
-		explicit ScopedLatency([[maybe_unused]] const std::string_view &name, Histogram<double> &histogram, std::map<std::string, std::string> attrs = {}, opentelemetry::context::Context context = opentelemetry::context::Context()) :
-			begin(std::chrono::steady_clock::now()), histogram(histogram), attrs(std::move(attrs)), context(std::move(context)) {
-		}
+		/**
+		 * \param cached whether the scope names form a fixed set, only then their series are kept forever;
+		 * open ended names (query prefixes with literal values) build their attributes on every measurement
+		 */
+		explicit ScopedLatency(std::string_view name, std::string_view histogramName, std::string_view scopeKey, bool cached);
+
+		// non-copyable, series may point to ownSeries
+		ScopedLatency(const ScopedLatency &) = delete;
+		ScopedLatency &operator=(const ScopedLatency &) = delete;
 
 		void stop();
 
@@ -65,24 +123,24 @@ namespace metrics {
 
 	private:
 		std::chrono::steady_clock::time_point begin;
-		Histogram<double> &histogram;
-		std::map<std::string, std::string> attrs;
-		opentelemetry::context::Context context;
+		const LatencySeries* series = nullptr;
+		LatencySeries ownSeries;
 		bool stopped { false };
 	};
 
-	#define DEFINE_LATENCY_CLASS(class_name, histogram_name, category)       \
-		class class_name##_latency final : public ScopedLatency {            \
-		public:                                                              \
-			class_name##_latency(std::string_view name) :                    \
-				ScopedLatency(name, histogram_name "_latency", category) { } \
+	#define DEFINE_LATENCY_CLASS(class_name, histogram_name, category, cached)       \
+		class class_name##_latency final : public ScopedLatency {                    \
+		public:                                                                      \
+			class_name##_latency(std::string_view name) :                            \
+				ScopedLatency(name, histogram_name "_latency", category, cached) { } \
 		}
 
-	DEFINE_LATENCY_CLASS(method, "method", "method");
-	DEFINE_LATENCY_CLASS(lua, "lua", "scope");
-	DEFINE_LATENCY_CLASS(query, "query", "truncated_query");
-	DEFINE_LATENCY_CLASS(task, "task", "task");
-	DEFINE_LATENCY_CLASS(lock, "lock", "scope");
+	DEFINE_LATENCY_CLASS(method, "method", "method", true);
+	DEFINE_LATENCY_CLASS(lua, "lua", "scope", true);
+	DEFINE_LATENCY_CLASS(query, "query", "truncated_query", false);
+	DEFINE_LATENCY_CLASS(task, "task", "task", true);
+	DEFINE_LATENCY_CLASS(lock, "lock", "scope", true);
+	DEFINE_LATENCY_CLASS(login, "login", "stage", true);
 
 	const std::vector<std::string> latencyNames {
 		"method_latency",
@@ -90,6 +148,7 @@ namespace metrics {
 		"query_latency",
 		"task_latency",
 		"lock_latency",
+		"login_latency",
 	};
 
 	class Metrics final {
@@ -103,6 +162,18 @@ namespace metrics {
 
 		static Metrics &getInstance();
 
+		/**
+		 * Registers a counter series, meant for hot paths: keep the handle (e.g. in a function-local static)
+		 * and add to it instead of calling addCounter. Registering the same name and attributes again returns the same series.
+		 * The per-thread values are summed when the exporter collects.
+		 *	\param name instrument name, must not also be used with addCounter
+		 *	\param attrs attribute set of every value added through the handle
+		 */
+		CounterHandle counter(std::string_view name, std::map<std::string, std::string> attrs = {});
+		// Same as counter, for up/down counters, the name must not also be used with addUpDownCounter
+		UpDownCounterHandle upDownCounter(std::string_view name, std::map<std::string, std::string> attrs = {});
+
+		// For series with dynamic attributes (e.g. player names), hot paths should use a pre-registered handle
 		void addCounter(std::string_view name, double value, std::map<std::string, std::string> attrs = {}) {
 			std::scoped_lock lock(mutex_);
 			if (!getMeter()) {
@@ -129,6 +200,8 @@ namespace metrics {
 			upDownCounters[name]->Add(value, attrskv);
 		}
 
+		static MetricShard &getThreadShard();
+
 		friend class ScopedLatency;
 
 	protected:
@@ -146,12 +219,58 @@ namespace metrics {
 		}
 
 	private:
+		// An observable instrument reporting the summed shards of its series
+		struct ShardedInstrument {
+			std::string name;
+			bool upDown = false;
+			std::vector<uint32_t> series;
+			opentelemetry::nostd::shared_ptr<metrics_api::ObservableInstrument> observable;
+		};
+
+		metrics_api::Histogram<double>* getLatencyHistogram(std::string_view histogramName);
+		const LatencySeries* getLatencySeries(std::string_view histogramName, std::string_view scopeKey, std::string_view name);
+
+		uint32_t registerSeries(std::string_view name, std::map<std::string, std::string> attrs, bool upDown);
+		void createObservableInstruments();
+		static void observeInstrument(metrics_api::ObserverResult result, void* state);
+
+		void registerShard(MetricShard* shard);
+		void retireShard(MetricShard* shard);
+
 		std::mutex mutex_;
 
+		std::mutex latencyMutex_;
+		// node map: cached series pointers stay valid
+		phmap::node_hash_map<std::string, LatencySeries> latencySeries;
+
+		// Guards the series registry and the shard list, also taken by the exporter while collecting
+		std::mutex shardsMutex_;
+		// Creating an observable instrument takes SDK locks the collection holds, so it is never done under shardsMutex_
+		std::mutex observablesMutex_;
+		phmap::node_hash_map<std::string, ShardedInstrument> shardedInstruments;
+		std::vector<std::map<std::string, std::string>> seriesAttributes;
+		std::vector<MetricShard*> shards;
+		// Values left by threads that already exited
+		std::vector<double> retiredValues;
+
 		std::string meterName { "stats" };
 		std::string otelVersion { "1.2.0" };
 		std::string otelSchema { "https://opentelemetry.io/schemas/1.2.0" };
+
+		friend struct ThreadShard;
 	};
+
+	inline void CounterHandle::add(double value) const {
+		if (id != INVALID_SERIES) {
+			Metrics::getThreadShard().add(id, value);
+		}
+	}
+
+	inline void UpDownCounterHandle::add(int64_t value) const {
+		if (id != INVALID_SERIES) {
+			Metrics::getThreadShard().add(id, static_cast<double>(value));
+		}
+	}
 }
 
 constexpr auto g_metrics
@@ -168,8 +287,7 @@ struct Options {
 
 class ScopedLatency {
 public:
-	explicit ScopedLatency([[maybe_unused]] std::string_view name, [[maybe_unused]] const std::string &histogramName, [[maybe_unused]] const std::string &scopeKey) {};
-	explicit ScopedLatency([[maybe_unused]] std::string_view name, [[maybe_unused]] std::set<double> &histogram, [[maybe_unused]] const std::map<std::string, std::string> &attrs = {}, [[maybe_unused]] const std::string &context = std::string()) {};
+	explicit ScopedLatency([[maybe_unused]] std::string_view name, [[maybe_unused]] std::string_view histogramName, [[maybe_unused]] std::string_view scopeKey, [[maybe_unused]] bool cached) {};
 
 	void stop() {};
 
@@ -177,18 +295,29 @@ public:
 };
 
 namespace metrics {
-	#define DEFINE_LATENCY_CLASS(class_name, histogram_name, category)       \
-		class class_name##_latency final : public ScopedLatency {            \
-		public:                                                              \
-			class_name##_latency(std::string_view name) :                    \
-				ScopedLatency(name, histogram_name "_latency", category) { } \
+	class CounterHandle {
+	public:
+		void add([[maybe_unused]] double value) const { }
+	};
+
+	class UpDownCounterHandle {
+	public:
+		void add([[maybe_unused]] int64_t value) const { }
+	};
+
+	#define DEFINE_LATENCY_CLASS(class_name, histogram_name, category, cached)       \
+		class class_name##_latency final : public ScopedLatency {                    \
+		public:                                                                      \
+			class_name##_latency(std::string_view name) :                            \
+				ScopedLatency(name, histogram_name "_latency", category, cached) { } \
 		}
 
-	DEFINE_LATENCY_CLASS(method, "method", "method");
-	DEFINE_LATENCY_CLASS(lua, "lua", "scope");
-	DEFINE_LATENCY_CLASS(query, "query", "truncated_query");
-	DEFINE_LATENCY_CLASS(task, "task", "task");
-	DEFINE_LATENCY_CLASS(lock, "lock", "scope");
+	DEFINE_LATENCY_CLASS(method, "method", "method", true);
+	DEFINE_LATENCY_CLASS(lua, "lua", "scope", true);
+	DEFINE_LATENCY_CLASS(query, "query", "truncated_query", false);
+	DEFINE_LATENCY_CLASS(task, "task", "task", true);
+	DEFINE_LATENCY_CLASS(lock, "lock", "scope", true);
+	DEFINE_LATENCY_CLASS(login, "login", "stage", true);
 
 	const std::vector<std::string> latencyNames {
 		"method_latency",
@@ -196,6 +325,7 @@ namespace metrics {
 		"query_latency",
 		"task_latency",
 		"lock_latency",
+		"login_latency",
 	};
 
 	class Metrics final {
@@ -211,6 +341,14 @@ namespace metrics {
 			return inject<Metrics>();
 		};
 
+		CounterHandle counter([[maybe_unused]] std::string_view name, [[maybe_unused]] const std::map<std::string, std::string> &attrs = {}) {
+			return {};
+		}
+
+		UpDownCounterHandle upDownCounter([[maybe_unused]] std::string_view name, [[maybe_unused]] const std::map<std::string, std::string> &attrs = {}) {
+			return {};
+		}
+
 		void addCounter([[maybe_unused]] std::string_view name, [[maybe_unused]] double value, [[maybe_unused]] const std::map<std::string, std::string> &attrs = {}) { }
 
 		void addUpDownCounter([[maybe_unused]] std::string_view name, [[maybe_unused]] int value, [[maybe_unused]] const std::map<std::string, std::string> &attrs = {}) { }
@@ -12,6 +12,7 @@
 #include "lua/callbacks/events_callbacks.hpp"
 
 #include "lua/callbacks/event_callback.hpp"
+#include "lib/metrics/metrics.hpp"
 
 /**
  * @class EventsCallbacks
@@ -29,26 +30,42 @@ EventsCallbacks &EventsCallbacks::getInstance() {
 }
 
 void EventsCallbacks::addCallback(const std::shared_ptr<EventCallback> callback) {
+	const auto index = static_cast<size_t>(callback->getType());
+	if (index >= m_callbacksByType.size()) {
+		g_logger().error("[{}] Invalid event callback type: {}", __FUNCTION__, index);
+		return;
+	}
+
 	m_callbacks.push_back(callback);
+	m_callbacksByType[index].push_back(callback);
 }
 
 std::vector<std::shared_ptr<EventCallback>> EventsCallbacks::getCallbacks() const {
 	return m_callbacks;
 }
 
-std::vector<std::shared_ptr<EventCallback>> EventsCallbacks::getCallbacksByType(EventCallback_t type) const {
-	std::vector<std::shared_ptr<EventCallback>> eventCallbacks;
-	for (auto callback : getCallbacks()) {
-		if (callback->getType() != type) {
-			continue;
-		}
-
-		eventCallbacks.push_back(callback);
-	}
-
-	return eventCallbacks;
+const std::vector<std::shared_ptr<EventCallback>> &EventsCallbacks::getCallbacksByType(EventCallback_t type) const {
+	return m_callbacksByType[static_cast<size_t>(type)];
 }
 
 void EventsCallbacks::clear() {
 	m_callbacks.clear();
+	for (auto &callbacks : m_callbacksByType) {
+		callbacks.clear();
+	}
+}
+
+void EventsCallbacks::reportExecutions() {
+	for (size_t index = 0; index < m_executions.size(); ++index) {
+		auto &stats = m_executions[index];
+		if (stats.count == 0) {
+			continue;
+		}
+
+		const std::map<std::string, std::string> attributes = { { "type", std::string(magic_enum::enum_name(static_cast<EventCallback_t>(index))) } };
+		const auto luaTime = std::chrono::duration<double, std::milli>(stats.luaTime).count();
+		g_metrics().addCounter("event_callback_executions", static_cast<double>(stats.count), attributes);
+		g_metrics().addCounter("event_callback_lua_ms", luaTime, attributes);
+		stats = {};
+	}
 }
@@ -60,15 +60,20 @@ public:
 	/**
 	 * @brief Gets event callbacks by their type.
 	 * @param type The type of callbacks to retrieve.
-	 * @return Vector of pointers to EventCallback objects of the specified type.
+	 * @return Vector of pointers to EventCallback objects of the specified type, filled at registration.
 	 */
-	std::vector<std::shared_ptr<EventCallback>> getCallbacksByType(EventCallback_t type) const;
+	const std::vector<std::shared_ptr<EventCallback>> &getCallbacksByType(EventCallback_t type) const;
 
 	/**
 	 * @brief Clears all registered event callbacks.
 	 */
 	void clear();
 
+	/**
+	 * @brief Sends the callback executions and Lua time per event type to the metrics and resets them.
+	 */
+	void reportExecutions();
+
 	/**
 	 * @brief Executes the specified event callback.
 	 * @param eventType The type of event to trigger.
@@ -77,15 +82,11 @@ public:
 	 */
 	template <typename CallbackFunc, typename... Args>
 	void executeCallback(EventCallback_t eventType, CallbackFunc callbackFunc, Args &&... args) {
-		for (const auto &callback : getCallbacksByType(eventType)) {
-			auto argsCopy = std::make_tuple(args...);
-			if (callback && callback->isLoadedCallback()) {
-				std::apply(
-					[&callback, &callbackFunc](auto &&... args) {
-						((*callback).*callbackFunc)(std::forward<decltype(args)>(args)...);
-					},
-					argsCopy
-				);
+		const auto index = static_cast<size_t>(eventType);
+		for (const auto &callback : m_callbacksByType[index]) {
+			if (callback->isLoadedCallback()) {
+				const ExecutionTimer timer(m_executions[index]);
+				((*callback).*callbackFunc)(args...);
 			}
 		}
 	}
@@ -98,22 +99,17 @@ public:
 	 */
 	template <typename CallbackFunc, typename... Args>
 	ReturnValue checkCallbackWithReturnValue(EventCallback_t eventType, CallbackFunc callbackFunc, Args &&... args) {
-		ReturnValue res = RETURNVALUE_NOERROR;
-		for (const auto &callback : getCallbacksByType(eventType)) {
-			auto argsCopy = std::make_tuple(args...);
-			if (callback && callback->isLoadedCallback()) {
-				ReturnValue callbackResult = std::apply(
-					[&callback, &callbackFunc](auto &&... args) {
-						return ((*callback).*callbackFunc)(std::forward<decltype(args)>(args)...);
-					},
-					argsCopy
-				);
+		const auto index = static_cast<size_t>(eventType);
+		for (const auto &callback : m_callbacksByType[index]) {
+			if (callback->isLoadedCallback()) {
+				const ExecutionTimer timer(m_executions[index]);
+				ReturnValue callbackResult = ((*callback).*callbackFunc)(args...);
 				if (callbackResult != RETURNVALUE_NOERROR) {
 					return callbackResult;
 				}
 			}
 		}
-		return res;
+		return RETURNVALUE_NOERROR;
 	}
 
 	/**
@@ -127,15 +123,11 @@ public:
 	bool checkCallback(EventCallback_t eventType, CallbackFunc callbackFunc, Args &&... args) {
 		bool allCallbacksSucceeded = true;
 
-		for (const auto &callback : getCallbacksByType(eventType)) {
-			auto argsCopy = std::make_tuple(args...);
-			if (callback && callback->isLoadedCallback()) {
-				bool callbackResult = std::apply(
-					[&callback, &callbackFunc](auto &&... args) {
-						return ((*callback).*callbackFunc)(std::forward<decltype(args)>(args)...);
-					},
-					argsCopy
-				);
+		const auto index = static_cast<size_t>(eventType);
+		for (const auto &callback : m_callbacksByType[index]) {
+			if (callback->isLoadedCallback()) {
+				const ExecutionTimer timer(m_executions[index]);
+				bool callbackResult = ((*callback).*callbackFunc)(args...);
 				allCallbacksSucceeded = allCallbacksSucceeded && callbackResult;
 			}
 		}
@@ -143,8 +135,43 @@ public:
 	}
 
 private:
+	static constexpr size_t EVENT_CALLBACK_TYPES = magic_enum::enum_count<EventCallback_t>();
+
+	/**
+	 * @brief Callback executions and time spent in them since the last report.
+	 */
+	struct ExecutionStats {
+		uint64_t count = 0;
+		std::chrono::steady_clock::duration luaTime {};
+	};
+
+	/**
+	 * @brief Adds one execution and its duration to the stats of an event type.
+	 */
+	class ExecutionTimer {
+	public:
+		explicit ExecutionTimer(ExecutionStats &stats) :
+			stats(stats), start(std::chrono::steady_clock::now()) { }
+
+		~ExecutionTimer() {
+			++stats.count;
+			stats.luaTime += std::chrono::steady_clock::now() - start;
+		}
+
+		ExecutionTimer(const ExecutionTimer &) = delete;
+		ExecutionTimer &operator=(const ExecutionTimer &) = delete;
+
+	private:
+		ExecutionStats &stats;
+		std::chrono::steady_clock::time_point start;
+	};
+
 	// Container for storing registered event callbacks.
 	std::vector<std::shared_ptr<EventCallback>> m_callbacks;
+	// Registered callbacks bucketed by EventCallback_t, so dispatching an event never filters the full list.
+	std::array<std::vector<std::shared_ptr<EventCallback>>, EVENT_CALLBACK_TYPES> m_callbacksByType;
+	// Only touched by the dispatcher thread, where the Lua callbacks run.
+	std::array<ExecutionStats, EVENT_CALLBACK_TYPES> m_executions {};
 };
 
 constexpr auto g_callbacks = EventsCallbacks::getInstance;
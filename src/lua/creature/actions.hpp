@@ -167,7 +167,7 @@ private:
 		return false;
 	}
 
-	[[nodiscard]] std::map<Position, std::shared_ptr<Action>> getPositionsMap() const {
+	[[nodiscard]] const phmap::flat_hash_map<Position, std::shared_ptr<Action>> &getPositionsMap() const {
 		return actionPositionMap;
 	}
 
@@ -214,11 +214,11 @@ private:
 	ReturnValue internalUseItem(std::shared_ptr<Player> player, const Position &pos, uint8_t index, std::shared_ptr<Item> item, bool isHotkey);
 	static void showUseHotkeyMessage(std::shared_ptr<Player> player, std::shared_ptr<Item> item, uint32_t count);
 
-	using ActionUseMap = std::map<uint16_t, std::shared_ptr<Action>>;
+	using ActionUseMap = phmap::flat_hash_map<uint16_t, std::shared_ptr<Action>>;
 	ActionUseMap useItemMap;
 	ActionUseMap uniqueItemMap;
 	ActionUseMap actionItemMap;
-	std::map<Position, std::shared_ptr<Action>> actionPositionMap;
+	phmap::flat_hash_map<Position, std::shared_ptr<Action>> actionPositionMap;
 
 	std::shared_ptr<Action> getAction(std::shared_ptr<Item> item);
 };
@@ -33,6 +33,7 @@ void MoveEvents::clear(bool isFromXML /*= false*/) {
 					return removed;
 				});
 			}
+			setEventTypes(itemIdEventTypes, pair.first, moveEventList);
 		}
 
 		if (numRemoved > 0) {
@@ -45,6 +46,30 @@ void MoveEvents::clear(bool isFromXML /*= false*/) {
 	actionIdMap.clear();
 	itemIdMap.clear();
 	positionsMap.clear();
+	uniqueIdEventTypes.clear();
+	actionIdEventTypes.clear();
+	itemIdEventTypes.clear();
+}
+
+void MoveEvents::setEventTypes(std::vector<uint8_t> &eventTypes, int32_t id, const MoveEventList &moveEventList) {
+	if (id < 0) {
+		return;
+	}
+
+	uint8_t mask = 0;
+	for (int moveEventType = 0; moveEventType < MOVE_EVENT_LAST; ++moveEventType) {
+		if (!moveEventList.moveEvent[moveEventType].empty()) {
+			mask |= 1 << moveEventType;
+		}
+	}
+
+	if (static_cast<size_t>(id) >= eventTypes.size()) {
+		if (mask == 0) {
+			return;
+		}
+		eventTypes.resize(id + 1);
+	}
+	eventTypes[id] = mask;
 }
 
 bool MoveEvents::registerLuaItemEvent(const std::shared_ptr<MoveEvent> moveEvent) {
@@ -64,7 +89,7 @@ bool MoveEvents::registerLuaItemEvent(const std::shared_ptr<MoveEvent> moveEvent
 			it.minReqMagicLevel = moveEvent->getReqMagLv();
 			it.vocationString = moveEvent->getVocationString();
 		}
-		if (registerEvent(moveEvent, itemId, itemIdMap)) {
+		if (registerEvent(moveEvent, itemId, itemIdMap, itemIdEventTypes)) {
 			tmpVector.emplace_back(itemId);
 		}
 	}
@@ -83,7 +108,7 @@ bool MoveEvents::registerLuaActionEvent(const std::shared_ptr<MoveEvent> moveEve
 	tmpVector.reserve(actionIdVector.size());
 
 	for (const auto &actionId : actionIdVector) {
-		if (registerEvent(moveEvent, actionId, actionIdMap)) {
+		if (registerEvent(moveEvent, actionId, actionIdMap, actionIdEventTypes)) {
 			tmpVector.emplace_back(actionId);
 		}
 	}
@@ -102,7 +127,7 @@ bool MoveEvents::registerLuaUniqueEvent(const std::shared_ptr<MoveEvent> moveEve
 	tmpVector.reserve(uniqueIdVector.size());
 
 	for (const auto &uniqueId : uniqueIdVector) {
-		if (registerEvent(moveEvent, uniqueId, uniqueIdMap)) {
+		if (registerEvent(moveEvent, uniqueId, uniqueIdMap, uniqueIdEventTypes)) {
 			tmpVector.emplace_back(uniqueId);
 		}
 	}
@@ -147,11 +172,12 @@ bool MoveEvents::registerLuaEvent(const std::shared_ptr<MoveEvent> moveEvent) {
 	}
 }
 
-bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, std::map<int32_t, MoveEventList> &moveListMap) const {
+bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, MoveEventIdMap &moveListMap, std::vector<uint8_t> &eventTypes) const {
 	auto it = moveListMap.find(id);
 	if (it == moveListMap.end()) {
 		MoveEventList moveEventList;
 		moveEventList.moveEvent[moveEvent->getEventType()].push_back(moveEvent);
+		setEventTypes(eventTypes, id, moveEventList);
 		moveListMap[id] = moveEventList;
 		return true;
 	} else {
@@ -168,6 +194,7 @@ bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32
 			}
 		}
 		moveEventList.push_back(moveEvent);
+		setEventTypes(eventTypes, id, it->second);
 		return true;
 	}
 }
@@ -211,17 +238,23 @@ std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &ite
 	}
 
 	if (item->hasAttribute(ItemAttribute_t::ACTIONID)) {
-		std::map<int32_t, MoveEventList>::iterator it = actionIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID));
-		if (it != actionIdMap.end()) {
-			std::list<std::shared_ptr<MoveEvent>> moveEventList = it->second.moveEvent[eventType];
-			for (const auto &moveEvent : moveEventList) {
-				if ((moveEvent->getSlot() & slotp) != 0) {
-					return moveEvent;
+		const auto actionId = item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID);
+		if (hasEventType(actionIdEventTypes, actionId, eventType)) {
+			if (auto it = actionIdMap.find(actionId);
+			    it != actionIdMap.end()) {
+				for (const auto &moveEvent : it->second.moveEvent[eventType]) {
+					if ((moveEvent->getSlot() & slotp) != 0) {
+						return moveEvent;
+					}
 				}
 			}
 		}
 	}
 
+	if (!hasEventType(itemIdEventTypes, item->getID(), eventType)) {
+		return nullptr;
+	}
+
 	auto it = itemIdMap.find(item->getID());
 	if (it != itemIdMap.end()) {
 		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
@@ -235,38 +268,36 @@ std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &ite
 }
 
 std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &item, MoveEvent_t eventType) {
-	std::map<int32_t, MoveEventList>::iterator it;
 	if (item->hasAttribute(ItemAttribute_t::UNIQUEID)) {
-		it = uniqueIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::UNIQUEID));
-		if (it != uniqueIdMap.end()) {
-			std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
-			if (!moveEventList.empty()) {
-				return *moveEventList.begin();
+		const auto uniqueId = item->getAttribute<uint16_t>(ItemAttribute_t::UNIQUEID);
+		if (hasEventType(uniqueIdEventTypes, uniqueId, eventType)) {
+			if (auto it = uniqueIdMap.find(uniqueId);
+			    it != uniqueIdMap.end() && !it->second.moveEvent[eventType].empty()) {
+				return it->second.moveEvent[eventType].front();
 			}
 		}
 	}
 
 	if (item->hasAttribute(ItemAttribute_t::ACTIONID)) {
-		it = actionIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID));
-		if (it != actionIdMap.end()) {
-			std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
-			if (!moveEventList.empty()) {
-				return *moveEventList.begin();
+		const auto actionId = item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID);
+		if (hasEventType(actionIdEventTypes, actionId, eventType)) {
+			if (auto it = actionIdMap.find(actionId);
+			    it != actionIdMap.end() && !it->second.moveEvent[eventType].empty()) {
+				return it->second.moveEvent[eventType].front();
 			}
 		}
 	}
 
-	it = itemIdMap.find(item->getID());
-	if (it != itemIdMap.end()) {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
-		if (!moveEventList.empty()) {
-			return *moveEventList.begin();
+	if (hasEventType(itemIdEventTypes, item->getID(), eventType)) {
+		if (auto it = itemIdMap.find(item->getID());
+		    it != itemIdMap.end() && !it->second.moveEvent[eventType].empty()) {
+			return it->second.moveEvent[eventType].front();
 		}
 	}
 	return nullptr;
 }
 
-bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, std::map<Position, MoveEventList> &moveListMap) const {
+bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, MoveEventPositionMap &moveListMap) const {
 	auto it = moveListMap.find(position);
 	if (it == moveListMap.end()) {
 		MoveEventList moveEventList;
@@ -291,6 +322,10 @@ bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const
 }
 
 std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Tile> &tile, MoveEvent_t eventType) {
+	if (positionsMap.empty()) {
+		return nullptr;
+	}
+
 	if (auto it = positionsMap.find(tile->getPosition());
 	    it != positionsMap.end()) {
 		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
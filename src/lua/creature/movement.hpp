@@ -21,7 +21,11 @@ struct MoveEventList {
 	std::list<std::shared_ptr<MoveEvent>> moveEvent[MOVE_EVENT_LAST];
 };
 
+static_assert(MOVE_EVENT_LAST <= 8, "MoveEvents keeps one bit per event type in an uint8_t");
+
 using VocEquipMap = std::map<uint16_t, bool>;
+using MoveEventIdMap = phmap::flat_hash_map<int32_t, MoveEventList>;
+using MoveEventPositionMap = phmap::flat_hash_map<Position, MoveEventList>;
 
 class MoveEvents final : public Scripts {
 public:
@@ -41,7 +45,7 @@ public:
 	uint32_t onPlayerDeEquip(const std::shared_ptr<Player> &player, const std::shared_ptr<Item> &item, Slots_t slot);
 	uint32_t onItemMove(const std::shared_ptr<Item> &item, const std::shared_ptr<Tile> &tile, bool isAdd);
 
-	std::map<Position, MoveEventList> getPositionsMap() const {
+	const MoveEventPositionMap &getPositionsMap() const {
 		return positionsMap;
 	}
 
@@ -57,7 +61,7 @@ public:
 		positionsMap.try_emplace(position, moveEventList);
 	}
 
-	std::map<int32_t, MoveEventList> getItemIdMap() const {
+	const MoveEventIdMap &getItemIdMap() const {
 		return itemIdMap;
 	}
 
@@ -70,10 +74,12 @@ public:
 	}
 
 	void setItemId(int32_t itemId, MoveEventList moveEventList) {
-		itemIdMap.try_emplace(itemId, moveEventList);
+		if (itemIdMap.try_emplace(itemId, moveEventList).second) {
+			setEventTypes(itemIdEventTypes, itemId, moveEventList);
+		}
 	}
 
-	std::map<int32_t, MoveEventList> getUniqueIdMap() const {
+	const MoveEventIdMap &getUniqueIdMap() const {
 		return uniqueIdMap;
 	}
 
@@ -86,10 +92,12 @@ public:
 	}
 
 	void setUniqueId(int32_t uniqueId, MoveEventList moveEventList) {
-		uniqueIdMap.try_emplace(uniqueId, moveEventList);
+		if (uniqueIdMap.try_emplace(uniqueId, moveEventList).second) {
+			setEventTypes(uniqueIdEventTypes, uniqueId, moveEventList);
+		}
 	}
 
-	std::map<int32_t, MoveEventList> getActionIdMap() const {
+	const MoveEventIdMap &getActionIdMap() const {
 		return actionIdMap;
 	}
 
@@ -102,7 +110,9 @@ public:
 	}
 
 	void setActionId(int32_t actionId, MoveEventList moveEventList) {
-		actionIdMap.try_emplace(actionId, moveEventList);
+		if (actionIdMap.try_emplace(actionId, moveEventList).second) {
+			setEventTypes(actionIdEventTypes, actionId, moveEventList);
+		}
 	}
 
 	std::shared_ptr<MoveEvent> getEvent(const std::shared_ptr<Item> &item, MoveEvent_t eventType);
@@ -115,19 +125,26 @@ public:
 	void clear(bool isFromXML = false);
 
 private:
-	void clearMap(std::map<int32_t, MoveEventList> &map) const;
-	void clearPosMap(std::map<Position, MoveEventList> &map);
-
-	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, std::map<int32_t, MoveEventList> &moveListMap) const;
-	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, std::map<Position, MoveEventList> &moveListMap) const;
+	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, MoveEventIdMap &moveListMap, std::vector<uint8_t> &eventTypes) const;
+	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, MoveEventPositionMap &moveListMap) const;
 	std::shared_ptr<MoveEvent> getEvent(const std::shared_ptr<Tile> &tile, MoveEvent_t eventType);
 
 	std::shared_ptr<MoveEvent> getEvent(const std::shared_ptr<Item> &item, MoveEvent_t eventType, Slots_t slot);
 
-	std::map<int32_t, MoveEventList> uniqueIdMap;
-	std::map<int32_t, MoveEventList> actionIdMap;
-	std::map<int32_t, MoveEventList> itemIdMap;
-	std::map<Position, MoveEventList> positionsMap;
+	// Bit (1 << MoveEvent_t) of every event type registered for an id, so items without scripts are skipped without a map lookup
+	static bool hasEventType(const std::vector<uint8_t> &eventTypes, int32_t id, MoveEvent_t eventType) {
+		return id >= 0 && static_cast<size_t>(id) < eventTypes.size() && (eventTypes[id] & (1 << eventType)) != 0;
+	}
+	static void setEventTypes(std::vector<uint8_t> &eventTypes, int32_t id, const MoveEventList &moveEventList);
+
+	MoveEventIdMap uniqueIdMap;
+	MoveEventIdMap actionIdMap;
+	MoveEventIdMap itemIdMap;
+	MoveEventPositionMap positionsMap;
+
+	std::vector<uint8_t> uniqueIdEventTypes;
+	std::vector<uint8_t> actionIdEventTypes;
+	std::vector<uint8_t> itemIdEventTypes;
 };
 
 constexpr auto g_moveEvents = MoveEvents::getInstance;
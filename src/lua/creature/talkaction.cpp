@@ -18,16 +18,34 @@ TalkActions::~TalkActions() = default;
 
 void TalkActions::clear() {
 	talkActions.clear();
+	talkActionsByWord.clear();
 }
 
 bool TalkActions::registerLuaEvent(const TalkAction_ptr &talkAction) {
-	auto [iterator, inserted] = talkActions.try_emplace(talkAction->getWords(), talkAction);
-	return inserted;
+	const std::string &talkactionWords = talkAction->getWords();
+	auto [iterator, inserted] = talkActions.try_emplace(talkactionWords, talkAction);
+	if (!inserted) {
+		return false;
+	}
+
+	const auto index = [&](const std::string &word) {
+		auto &list = talkActionsByWord[word];
+		const auto position = std::ranges::upper_bound(list, talkactionWords, {}, &TalkAction::getWords);
+		list.insert(position, talkAction);
+	};
+	if (talkactionWords.find(',') != std::string::npos) {
+		for (const auto &word : split(talkactionWords)) {
+			index(word);
+		}
+	} else {
+		index(talkactionWords);
+	}
+	return true;
 }
 
 bool TalkActions::checkWord(std::shared_ptr<Player> player, SpeakClasses type, const std::string &words, const std::string_view &word, const TalkAction_ptr &talkActionPtr) const {
 	auto spacePos = std::ranges::find_if(words.begin(), words.end(), ::isspace);
-	std::string firstWord = words.substr(0, spacePos - words.begin());
+	const std::string_view firstWord(words.data(), spacePos - words.begin());
 
 	// Check for exact equality from saying word and talkaction stored word
 	if (firstWord != word) {
@@ -62,18 +80,17 @@ bool TalkActions::checkWord(std::shared_ptr<Player> player, SpeakClasses type, c
 }
 
 TalkActionResult_t TalkActions::checkPlayerCanSayTalkAction(std::shared_ptr<Player> player, SpeakClasses type, const std::string &words) const {
-	for (const auto &[talkactionWords, talkActionPtr] : talkActions) {
-		if (talkactionWords.find(',') != std::string::npos) {
-			auto wordsList = split(talkactionWords);
-			for (const auto &word : wordsList) {
-				if (checkWord(player, type, words, word, talkActionPtr)) {
-					return TALKACTION_BREAK;
-				}
-			}
-		} else {
-			if (checkWord(player, type, words, talkactionWords, talkActionPtr)) {
-				return TALKACTION_BREAK;
-			}
+	auto spacePos = std::ranges::find_if(words.begin(), words.end(), ::isspace);
+	const std::string_view firstWord(words.data(), spacePos - words.begin());
+
+	const auto it = talkActionsByWord.find(firstWord);
+	if (it == talkActionsByWord.end()) {
+		return TALKACTION_CONTINUE;
+	}
+
+	for (const auto &talkActionPtr : it->second) {
+		if (checkWord(player, type, words, firstWord, talkActionPtr)) {
+			return TALKACTION_BREAK;
 		}
 	}
 	return TALKACTION_CONTINUE;
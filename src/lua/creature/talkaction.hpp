@@ -94,6 +94,8 @@ public:
 
 private:
 	std::map<std::string, std::shared_ptr<TalkAction>> talkActions;
+	// Talkactions by each of their words, in talkActions order, so a said line only checks the ones of its first word
+	phmap::flat_hash_map<std::string, std::vector<TalkAction_ptr>> talkActionsByWord;
 };
 
 constexpr auto g_talkActions = TalkActions::getInstance;
@@ -129,8 +129,8 @@ int GameFunctions::luaGameGetBestiaryList(lua_State* L) {
 	bool name = getBoolean(L, 2, false);
 
 	if (lua_gettop(L) <= 2) {
-		std::map<uint16_t, std::string> mtype_list = g_game().getBestiaryList();
-		for (auto ita : mtype_list) {
+		const auto &mtype_list = g_game().getBestiaryList();
+		for (const auto &ita : mtype_list) {
 			if (name) {
 				pushString(L, ita.second);
 			} else {
@@ -223,7 +223,7 @@ int GameFunctions::luaGameGetNpcCount(lua_State* L) {
 
 int GameFunctions::luaGameGetMonsterTypes(lua_State* L) {
 	// Game.getMonsterTypes()
-	const auto type = g_monsters().monsters;
+	const auto &type = g_monsters().monsters;
 	lua_createtable(L, type.size(), 0);
 
 	for (const auto &[typeName, mType] : type) {
@@ -11,10 +11,20 @@
 
 #include "lua/functions/core/libs/metrics_functions.hpp"
 #include "lib/metrics/metrics.hpp"
+#include "lua/scripts/lua_profiler.hpp"
+#include "game/scheduling/dispatcher.hpp"
 
 void MetricsFunctions::init(lua_State* L) {
 	registerTable(L, "metrics");
 	registerMethod(L, "metrics", "addCounter", MetricsFunctions::luaMetricsAddCounter);
+	registerMethod(L, "metrics", "startLuaProfiler", MetricsFunctions::luaMetricsStartLuaProfiler);
+	registerMethod(L, "metrics", "stopLuaProfiler", MetricsFunctions::luaMetricsStopLuaProfiler);
+	registerMethod(L, "metrics", "resetLuaProfiler", MetricsFunctions::luaMetricsResetLuaProfiler);
+	registerMethod(L, "metrics", "isLuaProfilerRunning", MetricsFunctions::luaMetricsIsLuaProfilerRunning);
+	registerMethod(L, "metrics", "getLuaProfilerReport", MetricsFunctions::luaMetricsGetLuaProfilerReport);
+	registerMethod(L, "metrics", "dumpLuaProfiler", MetricsFunctions::luaMetricsDumpLuaProfiler);
+	registerMethod(L, "metrics", "getDispatcherReport", MetricsFunctions::luaMetricsGetDispatcherReport);
+	registerMethod(L, "metrics", "resetDispatcherProfiler", MetricsFunctions::luaMetricsResetDispatcherProfiler);
 }
 
 // Metrics
@@ -27,6 +37,61 @@ int MetricsFunctions::luaMetricsAddCounter(lua_State* L) {
 	return 1;
 }
 
+int MetricsFunctions::luaMetricsStartLuaProfiler(lua_State* L) {
+	// metrics.startLuaProfiler()
+	g_luaProfiler().start();
+	pushBoolean(L, true);
+	return 1;
+}
+
+int MetricsFunctions::luaMetricsStopLuaProfiler(lua_State* L) {
+	// metrics.stopLuaProfiler()
+	g_luaProfiler().stop();
+	pushBoolean(L, true);
+	return 1;
+}
+
+int MetricsFunctions::luaMetricsResetLuaProfiler(lua_State* L) {
+	// metrics.resetLuaProfiler()
+	g_luaProfiler().reset();
+	pushBoolean(L, true);
+	return 1;
+}
+
+int MetricsFunctions::luaMetricsIsLuaProfilerRunning(lua_State* L) {
+	// metrics.isLuaProfilerRunning()
+	pushBoolean(L, g_luaProfiler().isRunning());
+	return 1;
+}
+
+int MetricsFunctions::luaMetricsGetLuaProfilerReport(lua_State* L) {
+	// metrics.getLuaProfilerReport([limit = 10])
+	const auto limit = getNumber<uint32_t>(L, 1, 10);
+	pushString(L, g_luaProfiler().getReport(limit));
+	return 1;
+}
+
+int MetricsFunctions::luaMetricsDumpLuaProfiler(lua_State* L) {
+	// metrics.dumpLuaProfiler()
+	g_luaProfiler().dump();
+	pushString(L, std::string(LuaProfiler::LUA_PROFILE_FILE));
+	return 1;
+}
+
+int MetricsFunctions::luaMetricsGetDispatcherReport(lua_State* L) {
+	// metrics.getDispatcherReport([limit = 10])
+	const auto limit = getNumber<uint32_t>(L, 1, 10);
+	pushString(L, g_dispatcher().getProfiler().getReport(limit));
+	return 1;
+}
+
+int MetricsFunctions::luaMetricsResetDispatcherProfiler(lua_State* L) {
+	// metrics.resetDispatcherProfiler()
+	g_dispatcher().getProfiler().reset();
+	pushBoolean(L, true);
+	return 1;
+}
+
 std::map<std::string, std::string> MetricsFunctions::getAttributes(lua_State* L, int32_t index) {
 	std::map<std::string, std::string> attributes;
 	if (isTable(L, index)) {
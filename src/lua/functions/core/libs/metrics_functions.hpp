@@ -17,5 +17,13 @@ public:
 
 private:
 	static int luaMetricsAddCounter(lua_State* L);
+	static int luaMetricsStartLuaProfiler(lua_State* L);
+	static int luaMetricsStopLuaProfiler(lua_State* L);
+	static int luaMetricsResetLuaProfiler(lua_State* L);
+	static int luaMetricsIsLuaProfilerRunning(lua_State* L);
+	static int luaMetricsGetLuaProfilerReport(lua_State* L);
+	static int luaMetricsDumpLuaProfiler(lua_State* L);
+	static int luaMetricsGetDispatcherReport(lua_State* L);
+	static int luaMetricsResetDispatcherProfiler(lua_State* L);
 	static std::map<std::string, std::string> getAttributes(lua_State* L, int32_t index);
 };
@@ -514,6 +514,7 @@ int MonsterTypeFunctions::luaMonsterTypeRaceid(lua_State* L) {
 		} else {
 			monsterType->info.raceid = getNumber<uint16_t>(L, 2);
 			g_game().addBestiaryList(getNumber<uint16_t>(L, 2), monsterType->name);
+			g_monsters().indexRaceId(monsterType->info.raceid);
 			pushBoolean(L, true);
 		}
 	} else {
@@ -899,7 +900,14 @@ int MonsterTypeFunctions::luaMonsterTypeAddElement(lua_State* L) {
 	const auto monsterType = getUserdataShared<MonsterType>(L, 1);
 	if (monsterType) {
 		CombatType_t element = getNumber<CombatType_t>(L, 2);
-		monsterType->info.elementMap[element] = getNumber<int32_t>(L, 3);
+		if (element >= COMBAT_COUNT) {
+			g_logger().warn("[MonsterTypeFunctions::luaMonsterTypeAddElement] - "
+			                "Invalid combat type {} for monster: {}",
+			                fmt::underlying(element), monsterType->name);
+			pushBoolean(L, false);
+			return 1;
+		}
+		monsterType->info.elementPercents[element] = getNumber<int32_t>(L, 3);
 		pushBoolean(L, true);
 	} else {
 		lua_pushnil(L);
@@ -912,7 +920,14 @@ int MonsterTypeFunctions::luaMonsterTypeAddReflect(lua_State* L) {
 	const auto monsterType = getUserdataShared<MonsterType>(L, 1);
 	if (monsterType) {
 		CombatType_t element = getNumber<CombatType_t>(L, 2);
-		monsterType->info.reflectMap[element] = getNumber<int32_t>(L, 3);
+		if (element >= COMBAT_COUNT) {
+			g_logger().warn("[MonsterTypeFunctions::luaMonsterTypeAddReflect] - "
+			                "Invalid combat type {} for monster: {}",
+			                fmt::underlying(element), monsterType->name);
+			pushBoolean(L, false);
+			return 1;
+		}
+		monsterType->info.reflectPercents[element] = getNumber<int32_t>(L, 3);
 		pushBoolean(L, true);
 	} else {
 		lua_pushnil(L);
@@ -925,7 +940,14 @@ int MonsterTypeFunctions::luaMonsterTypeAddHealing(lua_State* L) {
 	const auto monsterType = getUserdataShared<MonsterType>(L, 1);
 	if (monsterType) {
 		CombatType_t element = getNumber<CombatType_t>(L, 2);
-		monsterType->info.healingMap[element] = getNumber<int32_t>(L, 3);
+		if (element >= COMBAT_COUNT) {
+			g_logger().warn("[MonsterTypeFunctions::luaMonsterTypeAddHealing] - "
+			                "Invalid combat type {} for monster: {}",
+			                fmt::underlying(element), monsterType->name);
+			pushBoolean(L, false);
+			return 1;
+		}
+		monsterType->info.healingPercents[element] = getNumber<int32_t>(L, 3);
 		pushBoolean(L, true);
 	} else {
 		lua_pushnil(L);
@@ -941,10 +963,12 @@ int MonsterTypeFunctions::luaMonsterTypeGetElementList(lua_State* L) {
 		return 1;
 	}
 
-	lua_createtable(L, monsterType->info.elementMap.size(), 0);
-	for (const auto &elementEntry : monsterType->info.elementMap) {
-		lua_pushnumber(L, elementEntry.second);
-		lua_rawseti(L, -2, elementEntry.first);
+	lua_createtable(L, 0, 0);
+	for (size_t combatType = 0; combatType < COMBAT_COUNT; ++combatType) {
+		if (const int32_t percent = monsterType->info.elementPercents[combatType]; percent != 0) {
+			lua_pushnumber(L, percent);
+			lua_rawseti(L, -2, combatType);
+		}
 	}
 	return 1;
 }
@@ -1014,6 +1038,51 @@ int MonsterTypeFunctions::luaMonsterTypeAddLoot(lua_State* L) {
 	return 1;
 }
 
+int MonsterTypeFunctions::luaMonsterTypeRollLoot(lua_State* L) {
+	// monsterType:rollLoot(multiplier[, gutPercent = 0[, resultTable]])
+	const auto monsterType = getUserdataShared<MonsterType>(L, 1);
+	if (!monsterType) {
+		lua_pushnil(L);
+		return 1;
+	}
+
+	const auto multiplier = getNumber<double>(L, 2);
+	const auto gutPercent = getNumber<uint32_t>(L, 3, 0);
+	if (lua_istable(L, 4)) {
+		lua_pushvalue(L, 4);
+	} else {
+		lua_newtable(L);
+	}
+
+	std::vector<LootDrop> drops;
+	monsterType->getLootTable().roll(multiplier, gutPercent, drops, getRandomGenerator());
+	for (const auto &drop : drops) {
+		uint32_t count = drop.count;
+		lua_rawgeti(L, -1, drop.itemId);
+		if (lua_istable(L, -1)) {
+			lua_getfield(L, -1, "count");
+			count += getNumber<uint32_t>(L, -1);
+			lua_pop(L, 1);
+		} else {
+			lua_pop(L, 1);
+			lua_createtable(L, 0, 6);
+			lua_pushvalue(L, -1);
+			lua_rawseti(L, -3, drop.itemId);
+		}
+
+		setField(L, "count", count);
+		pushBoolean(L, drop.gut);
+		lua_setfield(L, -2, "gut");
+		pushBoolean(L, drop.entry->unique);
+		lua_setfield(L, -2, "unique");
+		setField(L, "subType", drop.entry->subType);
+		setField(L, "text", drop.entry->text);
+		setField(L, "actionId", drop.entry->actionId);
+		lua_pop(L, 1);
+	}
+	return 1;
+}
+
 int MonsterTypeFunctions::luaMonsterTypeGetCreatureEvents(lua_State* L) {
 	// monsterType:getCreatureEvents()
 	const auto monsterType = getUserdataShared<MonsterType>(L, 1);
@@ -88,6 +88,7 @@ public:
 
 		registerMethod(L, "MonsterType", "getLoot", MonsterTypeFunctions::luaMonsterTypeGetLoot);
 		registerMethod(L, "MonsterType", "addLoot", MonsterTypeFunctions::luaMonsterTypeAddLoot);
+		registerMethod(L, "MonsterType", "rollLoot", MonsterTypeFunctions::luaMonsterTypeRollLoot);
 
 		registerMethod(L, "MonsterType", "getCreatureEvents", MonsterTypeFunctions::luaMonsterTypeGetCreatureEvents);
 		registerMethod(L, "MonsterType", "registerEvent", MonsterTypeFunctions::luaMonsterTypeRegisterEvent);
@@ -218,6 +219,7 @@ private:
 
 	static int luaMonsterTypeGetLoot(lua_State* L);
 	static int luaMonsterTypeAddLoot(lua_State* L);
+	static int luaMonsterTypeRollLoot(lua_State* L);
 
 	static int luaMonsterTypeGetCreatureEvents(lua_State* L);
 	static int luaMonsterTypeRegisterEvent(lua_State* L);
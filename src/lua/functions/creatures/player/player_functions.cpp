@@ -22,6 +22,7 @@
 #include "creatures/players/cyclopedia/player_title.hpp"
 #include "game/game.hpp"
 #include "io/iologindata.hpp"
+#include "io/iomarket.hpp"
 #include "io/ioprey.hpp"
 #include "items/item.hpp"
 #include "game/scheduling/save_manager.hpp"
@@ -2924,9 +2925,10 @@ int PlayerFunctions::luaPlayerGetClient(lua_State* L) {
 	// player:getClient()
 	std::shared_ptr<Player> player = getUserdataShared<Player>(L, 1);
 	if (player) {
-		lua_createtable(L, 0, 2);
+		lua_createtable(L, 0, 3);
 		setField(L, "version", player->getProtocolVersion());
 		setField(L, "os", player->getOperatingSystem());
+		setField(L, "knownCreatureEvictions", player->getKnownCreatureEvictions());
 	} else {
 		lua_pushnil(L);
 	}
@@ -3761,6 +3763,7 @@ int PlayerFunctions::luaPlayerChangeName(lua_State* L) {
 	player->kv()->remove("namelock");
 	auto newName = getString(L, 2);
 	player->setName(newName);
+	IOMarket::updatePlayerName(player->getGUID(), newName);
 	g_saveManager().savePlayer(player);
 	return 1;
 }
@@ -26,6 +26,7 @@
 #include "lua/functions/map/map_functions.hpp"
 #include "lua/functions/core/game/zone_functions.hpp"
 #include "lua/global/lua_variant.hpp"
+#include "lua/scripts/lua_profiler.hpp"
 
 #include "enums/lua_variant_type.hpp"
 
@@ -99,11 +100,20 @@ int LuaFunctionsLoader::protectedCall(lua_State* L, int nargs, int nresults) {
 	}
 
 	int error_index = lua_gettop(L) - nargs;
+	// Kept for the whole call, so a script stopping the profiler still closes its own frame
+	const bool profiled = g_luaProfiler().isRunning();
+	if (profiled) {
+		g_luaProfiler().enter(L, error_index);
+	}
+
 	lua_pushcfunction(L, luaErrorHandler);
 	lua_insert(L, error_index);
 
 	int ret = lua_pcall(L, nargs, nresults, error_index);
 	lua_remove(L, error_index);
+	if (profiled) {
+		g_luaProfiler().leave(L);
+	}
 	return ret;
 }
 
@@ -0,0 +1,229 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lua/scripts/lua_profiler.hpp"
+#include "lua/scripts/luascript.hpp"
+#include "lib/thread/thread_pool.hpp"
+
+LuaProfiler &LuaProfiler::getInstance() {
+	return inject<LuaProfiler>();
+}
+
+void LuaProfiler::start() {
+	if (running) {
+		return;
+	}
+
+	running = true;
+	startTime = std::chrono::steady_clock::now();
+	g_logger().info("[{}] Lua profiler started", __FUNCTION__);
+}
+
+void LuaProfiler::stop() {
+	if (!running) {
+		return;
+	}
+
+	running = false;
+	profiledNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+	g_logger().info("[{}] Lua profiler stopped", __FUNCTION__);
+}
+
+void LuaProfiler::reset() {
+	// Names and the call tree shape are kept, open frames still point into them
+	for (auto &entry : scripts) {
+		entry = Entry { std::move(entry.name) };
+	}
+	for (auto &entry : functions) {
+		entry = Entry { std::move(entry.name) };
+	}
+	for (auto &node : nodes) {
+		node.exclusiveNs = 0;
+	}
+
+	profiledNs = 0;
+	startTime = std::chrono::steady_clock::now();
+}
+
+void LuaProfiler::enter(lua_State* L, int functionIndex) {
+	Frame frame;
+	frame.script = getScriptEntry();
+	frame.function = getFunctionEntry(L, functionIndex);
+	frame.node = getNode(frames.empty() ? 0 : frames.back().node, frame.function);
+	frame.memoryStart = getMemoryUsage(L);
+	frame.start = std::chrono::steady_clock::now();
+	frames.emplace_back(frame);
+}
+
+void LuaProfiler::leave(lua_State* L) {
+	if (frames.empty()) {
+		return;
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+	const Frame frame = frames.back();
+	frames.pop_back();
+
+	const int64_t inclusiveNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - frame.start).count();
+	const int64_t exclusiveNs = std::max<int64_t>(0, inclusiveNs - frame.childNs);
+	const int64_t inclusiveBytes = getMemoryUsage(L) - frame.memoryStart;
+	const int64_t exclusiveBytes = std::max<int64_t>(0, inclusiveBytes - frame.childBytes);
+
+	addCall(scripts[frame.script], inclusiveNs, exclusiveNs, exclusiveBytes);
+	addCall(functions[frame.function], inclusiveNs, exclusiveNs, exclusiveBytes);
+	nodes[frame.node].exclusiveNs += exclusiveNs;
+
+	if (!frames.empty()) {
+		frames.back().childNs += inclusiveNs;
+		frames.back().childBytes += inclusiveBytes;
+	}
+}
+
+void LuaProfiler::addCall(Entry &entry, int64_t inclusiveNs, int64_t exclusiveNs, int64_t exclusiveBytes) {
+	++entry.calls;
+	// Recursive calls count their inclusive time once per level
+	entry.inclusiveNs += inclusiveNs;
+	entry.exclusiveNs += exclusiveNs;
+	entry.allocatedBytes += exclusiveBytes;
+}
+
+uint32_t LuaProfiler::getScriptEntry() {
+	int32_t scriptId = 0;
+	int32_t callbackId = 0;
+	bool timerEvent = false;
+	LuaScriptInterface* scriptInterface = nullptr;
+	if (const auto env = LuaScriptInterface::getScriptEnv()) {
+		env->getEventInfo(scriptId, scriptInterface, callbackId, timerEvent);
+	}
+
+	const auto [it, inserted] = scriptIndex.try_emplace({ scriptInterface, scriptId }, static_cast<uint32_t>(scripts.size()));
+	if (inserted) {
+		std::string name;
+		if (!scriptInterface) {
+			name = "(no script)";
+		} else if (scriptId == EVENT_ID_LOADING) {
+			name = "loading";
+		} else {
+			name = scriptInterface->getFileById(scriptId);
+		}
+		scripts.emplace_back(Entry { std::move(name) });
+	}
+	return it->second;
+}
+
+uint32_t LuaProfiler::getFunctionEntry(lua_State* L, int functionIndex) {
+	lua_Debug ar;
+	lua_pushvalue(L, functionIndex);
+	lua_getinfo(L, ">S", &ar);
+
+	functionKey.clear();
+	fmt::format_to(std::back_inserter(functionKey), "{}:{}", ar.short_src, ar.linedefined);
+
+	const auto [it, inserted] = functionIds.try_emplace(functionKey, static_cast<uint32_t>(functions.size()));
+	if (inserted) {
+		functions.emplace_back(Entry { functionKey });
+	}
+	return it->second;
+}
+
+uint32_t LuaProfiler::getNode(uint32_t parent, uint32_t function) {
+	const uint64_t key = (static_cast<uint64_t>(parent) << 32) | function;
+	const auto [it, inserted] = nodeIndex.try_emplace(key, static_cast<uint32_t>(nodes.size()));
+	if (inserted) {
+		nodes.emplace_back(Node { parent, function });
+	}
+	return it->second;
+}
+
+int64_t LuaProfiler::getMemoryUsage(lua_State* L) {
+	return static_cast<int64_t>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
+}
+
+std::string LuaProfiler::getReport(size_t limit) const {
+	int64_t wallNs = profiledNs;
+	if (running) {
+		wallNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+	}
+
+	int64_t luaNs = 0;
+	for (const auto &entry : functions) {
+		luaNs += entry.exclusiveNs;
+	}
+
+	std::string report = fmt::format("Lua profiler ({}): {:.2f} ms in Lua over {:.1f} s profiled\n", running ? "running" : "stopped", luaNs / 1e6, wallNs / 1e9);
+
+	const auto appendSection = [&report, limit, luaNs](std::string_view title, const std::vector<Entry> &entries) {
+		std::vector<const Entry*> sorted;
+		sorted.reserve(entries.size());
+		for (const auto &entry : entries) {
+			if (entry.calls > 0) {
+				sorted.emplace_back(&entry);
+			}
+		}
+
+		const size_t count = std::min(limit, sorted.size());
+		std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(), [](const Entry* a, const Entry* b) {
+			return a->exclusiveNs > b->exclusiveNs;
+		});
+
+		fmt::format_to(std::back_inserter(report), "\n{} (calls, inclusive ms, exclusive ms, exclusive %, allocated KB):\n", title);
+		for (size_t i = 0; i < count; ++i) {
+			const Entry &entry = *sorted[i];
+			const double share = luaNs > 0 ? entry.exclusiveNs * 100.0 / luaNs : 0.0;
+			fmt::format_to(std::back_inserter(report), "{} | {:.2f} | {:.2f} | {:.1f}% | {} | {}\n", entry.calls, entry.inclusiveNs / 1e6, entry.exclusiveNs / 1e6, share, entry.allocatedBytes / 1024, entry.name);
+		}
+	};
+
+	appendSection("Scripts", scripts);
+	appendSection("Functions", functions);
+	return report;
+}
+
+std::string LuaProfiler::getFoldedStacks() const {
+	std::string folded;
+	std::vector<uint32_t> path;
+	for (uint32_t id = 1; id < nodes.size(); ++id) {
+		const int64_t microseconds = nodes[id].exclusiveNs / 1000;
+		if (microseconds == 0) {
+			continue;
+		}
+
+		path.clear();
+		for (uint32_t node = id; node != 0; node = nodes[node].parent) {
+			path.emplace_back(nodes[node].function);
+		}
+
+		for (auto it = path.rbegin(); it != path.rend(); ++it) {
+			if (it != path.rbegin()) {
+				folded += ';';
+			}
+			folded += functions[*it].name;
+		}
+		fmt::format_to(std::back_inserter(folded), " {}\n", microseconds);
+	}
+	return folded;
+}
+
+void LuaProfiler::dump() const {
+	auto folded = getFoldedStacks();
+	if (folded.empty()) {
+		return;
+	}
+
+	inject<ThreadPool>().detach_task([folded = std::move(folded)] {
+		std::ofstream file { std::string(LUA_PROFILE_FILE), std::ios::trunc };
+		if (!file) {
+			g_logger().error("[LuaProfiler::dump] - Can not write {}", LUA_PROFILE_FILE);
+			return;
+		}
+		file << folded;
+	});
+}
@@ -0,0 +1,112 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+class LuaScriptInterface;
+
+/**
+ * Opt-in profiler of the calls that enter Lua through LuaFunctionsLoader::protectedCall.
+ * Every call is attributed to its script id (the file/event the environment runs) and to the called function,
+ * with call count, inclusive and exclusive time and the exclusive growth of the Lua heap.
+ * Calls are also kept as a call tree, which is dumped as folded stacks (flamegraph.pl / speedscope format).
+ * While stopped the only cost left on the call path is the isRunning() check.
+ * Everything here runs on the dispatcher thread, like the Lua state itself.
+ */
+class LuaProfiler {
+public:
+	LuaProfiler() = default;
+
+	// non-copyable
+	LuaProfiler(const LuaProfiler &) = delete;
+	LuaProfiler &operator=(const LuaProfiler &) = delete;
+
+	static LuaProfiler &getInstance();
+
+	bool isRunning() const {
+		return running;
+	}
+
+	void start();
+	void stop();
+	// Zeroes the collected stats, calls in progress keep being measured
+	void reset();
+
+	/**
+	 * Opens a frame for the function about to be called.
+	 *	\param L the state the function will run on
+	 *	\param functionIndex stack index of the function
+	 */
+	void enter(lua_State* L, int functionIndex);
+	// Closes the frame opened by the last enter, must be called even if the profiler was stopped in between
+	void leave(lua_State* L);
+
+	/**
+	 * Text report of the most expensive scripts and functions, by exclusive time.
+	 *	\param limit max lines per section
+	 */
+	std::string getReport(size_t limit) const;
+	// Folded stacks, one "frame;frame;frame microseconds" line per call path
+	std::string getFoldedStacks() const;
+	// Writes the folded stacks to LUA_PROFILE_FILE on the thread pool
+	void dump() const;
+
+	static constexpr std::string_view LUA_PROFILE_FILE = "lua_profile.folded";
+
+private:
+	struct Entry {
+		std::string name;
+		uint64_t calls = 0;
+		int64_t inclusiveNs = 0;
+		int64_t exclusiveNs = 0;
+		// Exclusive heap growth, a lower bound of the bytes allocated: a collection inside the call hides its garbage
+		int64_t allocatedBytes = 0;
+	};
+
+	struct Node {
+		uint32_t parent = 0;
+		uint32_t function = 0;
+		int64_t exclusiveNs = 0;
+	};
+
+	struct Frame {
+		uint32_t script = 0;
+		uint32_t function = 0;
+		uint32_t node = 0;
+		std::chrono::steady_clock::time_point start;
+		int64_t memoryStart = 0;
+		int64_t childNs = 0;
+		int64_t childBytes = 0;
+	};
+
+	uint32_t getScriptEntry();
+	uint32_t getFunctionEntry(lua_State* L, int functionIndex);
+	uint32_t getNode(uint32_t parent, uint32_t function);
+	static int64_t getMemoryUsage(lua_State* L);
+	static void addCall(Entry &entry, int64_t inclusiveNs, int64_t exclusiveNs, int64_t exclusiveBytes);
+
+	bool running = false;
+	std::chrono::steady_clock::time_point startTime;
+	int64_t profiledNs = 0;
+
+	std::vector<Entry> scripts;
+	std::map<std::pair<const LuaScriptInterface*, int32_t>, uint32_t> scriptIndex;
+	std::vector<Entry> functions;
+	// Keyed by "source:line", function objects are recreated on reload and their addresses reused
+	phmap::flat_hash_map<std::string, uint32_t> functionIds;
+	std::string functionKey;
+
+	// Call tree, node 0 is the root
+	std::vector<Node> nodes { Node {} };
+	phmap::flat_hash_map<uint64_t, uint32_t> nodeIndex;
+
+	std::vector<Frame> frames;
+};
+
+constexpr auto g_luaProfiler = LuaProfiler::getInstance;
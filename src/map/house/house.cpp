@@ -773,12 +773,110 @@ bool Houses::loadHousesXML(const std::string &filename) {
 	return true;
 }
 
+namespace {
+	// The few columns of an offline house owner that charging rent needs, so paying houses doesn't load whole players
+	struct RentOwner {
+		std::string name;
+		uint64_t balance = 0;
+		time_t lastLogin = 0;
+		time_t premiumLastDay = 0;
+	};
+
+	phmap::flat_hash_map<uint32_t, RentOwner> loadRentOwners(const phmap::flat_hash_set<uint32_t> &ownerIds) {
+		phmap::flat_hash_map<uint32_t, RentOwner> owners;
+		if (ownerIds.empty()) {
+			return owners;
+		}
+
+		DBResult_ptr result = g_database().storeQuery(fmt::format(
+			"SELECT `players`.`id`, `players`.`name`, `players`.`balance`, `players`.`lastlogin`, `accounts`.`lastday` "
+			"FROM `players` INNER JOIN `accounts` ON `accounts`.`id` = `players`.`account_id` WHERE `players`.`id` IN ({})",
+			fmt::join(ownerIds.begin(), ownerIds.end(), ",")
+		));
+		if (!result) {
+			return owners;
+		}
+
+		do {
+			RentOwner &owner = owners[result->getNumber<uint32_t>("id")];
+			owner.name = result->getString("name");
+			owner.balance = result->getNumber<uint64_t>("balance");
+			owner.lastLogin = result->getNumber<time_t>("lastlogin");
+			owner.premiumLastDay = result->getNumber<time_t>("lastday");
+		} while (result->next());
+		return owners;
+	}
+
+	time_t getRentPeriodSeconds(RentPeriod_t rentPeriod) {
+		switch (rentPeriod) {
+			case RENTPERIOD_DAILY:
+				return 24 * 60 * 60;
+			case RENTPERIOD_WEEKLY:
+				return 24 * 60 * 60 * 7;
+			case RENTPERIOD_MONTHLY:
+				return 24 * 60 * 60 * 30;
+			case RENTPERIOD_YEARLY:
+				return 24 * 60 * 60 * 365;
+			default:
+				return 0;
+		}
+	}
+
+	std::string getRentPeriodName(RentPeriod_t rentPeriod) {
+		switch (rentPeriod) {
+			case RENTPERIOD_DAILY:
+				return "daily";
+			case RENTPERIOD_WEEKLY:
+				return "weekly";
+			case RENTPERIOD_MONTHLY:
+				return "monthly";
+			case RENTPERIOD_YEARLY:
+				return "annual";
+			default:
+				return "";
+		}
+	}
+}
+
 void Houses::payHouses(RentPeriod_t rentPeriod) const {
 	if (rentPeriod == RENTPERIOD_NEVER) {
 		return;
 	}
 
+	Benchmark bm_payHouses;
 	time_t currentTime = time(nullptr);
+
+	// Offline owners are read with a single query, only the ones that get a letter or lose their house are fully loaded
+	phmap::flat_hash_set<uint32_t> ownerIds;
+	for (const auto &[houseId, house] : houseMap) {
+		if (house->getOwner() != 0 && !g_game().getPlayerByGUID(house->getOwner())) {
+			ownerIds.emplace(house->getOwner());
+		}
+	}
+	auto rentOwners = loadRentOwners(ownerIds);
+
+	// Rent of offline owners is debited from `players`.`balance` in one statement after the loop
+	phmap::flat_hash_map<uint32_t, uint64_t> pendingDebits;
+	phmap::flat_hash_map<uint32_t, std::shared_ptr<Player>> loadedOwners;
+	const auto loadOwner = [&](uint32_t ownerId) -> std::shared_ptr<Player> {
+		auto player = g_game().getPlayerByGUID(ownerId, true);
+		if (!player) {
+			return nullptr;
+		}
+
+		if (auto it = pendingDebits.find(ownerId); it != pendingDebits.end()) {
+			player->setBankBalance(player->getBankBalance() - std::min(player->getBankBalance(), it->second));
+			pendingDebits.erase(it);
+		}
+		loadedOwners[ownerId] = player;
+		return player;
+	};
+
+	const bool vipSystem = g_configManager().getBoolean(VIP_SYSTEM_ENABLED, __FUNCTION__);
+	const auto daysToReset = g_configManager().getNumber(HOUSE_LOSE_AFTER_INACTIVITY, __FUNCTION__);
+	uint32_t paidHouses = 0;
+	uint32_t warnedHouses = 0;
+	uint32_t resetHouses = 0;
 	for (const auto &it : houseMap) {
 		std::shared_ptr<House> house = it.second;
 		if (house->getOwner() == 0) {
@@ -791,25 +889,37 @@ void Houses::payHouses(RentPeriod_t rentPeriod) const {
 			continue;
 		}
 
-		auto player = g_game().getPlayerByGUID(ownerId, true);
+		std::shared_ptr<Player> player = g_game().getPlayerByGUID(ownerId);
+		RentOwner* owner = nullptr;
 		if (!player) {
-			// Player doesn't exist, reset house owner
-			house->tryTransferOwnership(nullptr, true);
-			continue;
+			if (auto loadedIt = loadedOwners.find(ownerId); loadedIt != loadedOwners.end()) {
+				player = loadedIt->second;
+			} else if (auto ownerIt = rentOwners.find(ownerId); ownerIt != rentOwners.end()) {
+				owner = &ownerIt->second;
+			} else {
+				// Player doesn't exist, reset house owner
+				house->tryTransferOwnership(nullptr, true);
+				continue;
+			}
 		}
 
+		const std::string &ownerName = player ? player->getName() : owner->name;
+
 		// Player hasn't logged in for a while, reset house owner
-		auto daysToReset = g_configManager().getNumber(HOUSE_LOSE_AFTER_INACTIVITY, __FUNCTION__);
 		if (daysToReset > 0) {
-			auto daysSinceLastLogin = (currentTime - player->getLastLoginSaved()) / (60 * 60 * 24);
-			bool vipKeep = g_configManager().getBoolean(VIP_KEEP_HOUSE, __FUNCTION__) && player->isVip();
+			auto daysSinceLastLogin = (currentTime - (player ? player->getLastLoginSaved() : owner->lastLogin)) / (60 * 60 * 24);
+			bool vipKeep = g_configManager().getBoolean(VIP_KEEP_HOUSE, __FUNCTION__) && (player ? player->isVip() : vipSystem && owner->premiumLastDay > currentTime);
 			bool activityKeep = daysSinceLastLogin < daysToReset;
 			if (vipKeep && !activityKeep) {
-				g_logger().info("Player {} has not logged in for {} days, but is a VIP, so the house will not be reset.", player->getName(), daysToReset);
+				g_logger().info("Player {} has not logged in for {} days, but is a VIP, so the house will not be reset.", ownerName, daysToReset);
 			} else if (!vipKeep && !activityKeep) {
-				g_logger().info("Player {} has not logged in for {} days, so the house will be reset.", player->getName(), daysToReset);
+				g_logger().info("Player {} has not logged in for {} days, so the house will be reset.", ownerName, daysToReset);
+				if (!player && !(player = loadOwner(ownerId))) {
+					continue;
+				}
 				house->setOwner(0, true, player);
 				g_saveManager().savePlayer(player);
+				++resetHouses;
 				continue;
 			}
 		}
@@ -819,69 +929,59 @@ void Houses::payHouses(RentPeriod_t rentPeriod) const {
 			continue;
 		}
 
-		if (player->getBankBalance() >= rent) {
-			g_game().removeMoney(player, rent, 0, true);
-			g_metrics().addCounter("balance_decrease", rent, { { "player", player->getName() }, { "context", "house_rent" } });
-
-			time_t paidUntil = currentTime;
-			switch (rentPeriod) {
-				case RENTPERIOD_DAILY:
-					paidUntil += 24 * 60 * 60;
-					break;
-				case RENTPERIOD_WEEKLY:
-					paidUntil += 24 * 60 * 60 * 7;
-					break;
-				case RENTPERIOD_MONTHLY:
-					paidUntil += 24 * 60 * 60 * 30;
-					break;
-				case RENTPERIOD_YEARLY:
-					paidUntil += 24 * 60 * 60 * 365;
-					break;
-				default:
-					break;
+		if ((player ? player->getBankBalance() : owner->balance) >= rent) {
+			if (player) {
+				g_game().removeMoney(player, rent, 0, true);
+			} else {
+				owner->balance -= rent;
+				pendingDebits[ownerId] += rent;
 			}
+			g_metrics().addCounter("balance_decrease", rent, { { "player", ownerName }, { "context", "house_rent" } });
 
-			house->setPaidUntil(paidUntil);
+			house->setPaidUntil(currentTime + getRentPeriodSeconds(rentPeriod));
+			++paidHouses;
+			if (!player) {
+				continue;
+			}
 		} else {
+			if (!player && !(player = loadOwner(ownerId))) {
+				continue;
+			}
+
 			if (house->getPayRentWarnings() < 7) {
 				int32_t daysLeft = 7 - house->getPayRentWarnings();
 
 				std::shared_ptr<Item> letter = Item::CreateItem(ITEM_LETTER_STAMPED);
-				std::string period;
-
-				switch (rentPeriod) {
-					case RENTPERIOD_DAILY:
-						period = "daily";
-						break;
-
-					case RENTPERIOD_WEEKLY:
-						period = "weekly";
-						break;
-
-					case RENTPERIOD_MONTHLY:
-						period = "monthly";
-						break;
-
-					case RENTPERIOD_YEARLY:
-						period = "annual";
-						break;
-
-					default:
-						break;
-				}
-
 				std::ostringstream ss;
-				ss << "Warning! \nThe " << period << " rent of " << house->getRent() << " gold for your house \"" << house->getName() << "\" is payable. Have it within " << daysLeft << " days or you will lose static_self_cast<HouseTransferItem>() house.";
+				ss << "Warning! \nThe " << getRentPeriodName(rentPeriod) << " rent of " << house->getRent() << " gold for your house \"" << house->getName() << "\" is payable. Have it within " << daysLeft << " days or you will lose static_self_cast<HouseTransferItem>() house.";
 				letter->setAttribute(ItemAttribute_t::TEXT, ss.str());
 				g_game().internalAddItem(player->getInbox(), letter, INDEX_WHEREEVER, FLAG_NOLIMIT);
 				house->setPayRentWarnings(house->getPayRentWarnings() + 1);
+				++warnedHouses;
 			} else {
 				house->setOwner(0, true, player);
+				++resetHouses;
 			}
 		}
 
 		g_saveManager().savePlayer(player);
 	}
+
+	if (!pendingDebits.empty()) {
+		std::ostringstream query;
+		std::ostringstream ids;
+		query << "UPDATE `players` SET `balance` = `balance` - CASE `id`";
+		for (const auto &[ownerId, debit] : pendingDebits) {
+			query << " WHEN " << ownerId << " THEN " << debit;
+			ids << (ids.tellp() > 0 ? "," : "") << ownerId;
+		}
+		query << " ELSE 0 END WHERE `id` IN (" << ids.str() << ')';
+		if (!g_database().executeQuery(query.str())) {
+			g_logger().error("[{}] Failed to debit the rent of {} offline house owners", __FUNCTION__, pendingDebits.size());
+		}
+	}
+
+	g_logger().info("Charged house rent in {} ms: {} paid, {} warned, {} reset, {} of {} offline owners fully loaded", bm_payHouses.duration(), paidHouses, warnedHouses, resetHouses, loadedOwners.size(), rentOwners.size());
 }
 
 uint32_t House::getRent() const {
@@ -11,6 +11,7 @@
 
 #include "map.hpp"
 #include "utils/astarnodes.hpp"
+#include "map/utils/sightline.hpp"
 
 #include "creatures/monsters/monster.hpp"
 #include "game/game.hpp"
@@ -215,10 +216,40 @@ void Map::setTile(uint16_t x, uint16_t y, uint8_t z, std::shared_ptr<Tile> newTi
 		return;
 	}
 
-	if (const auto sector = getMapSector(x, y)) {
-		sector->createFloor(z)->setTile(x, y, newTile);
-	} else {
-		getBestMapSector(x, y)->createFloor(z)->setTile(x, y, newTile);
+	const auto &floor = [&]() -> const std::unique_ptr<Floor> & {
+		if (const auto sector = getMapSector(x, y)) {
+			return sector->createFloor(z);
+		}
+		return getBestMapSector(x, y)->createFloor(z);
+	}();
+
+	floor->setTile(x, y, newTile);
+	floor->setProjectileBlocked(x, y, newTile && newTile->hasProperty(CONST_PROP_BLOCKPROJECTILE));
+}
+
+bool Map::isProjectileBlocked(uint16_t x, uint16_t y, uint8_t z) const {
+	if (z >= MAP_MAX_LAYERS) {
+		return false;
+	}
+
+	const auto sector = getMapSector(x, y);
+	if (!sector) {
+		return false;
+	}
+
+	const auto &floor = sector->getFloor(z);
+	return floor && floor->isProjectileBlocked(x, y);
+}
+
+void Map::setProjectileBlocked(const Position &pos, bool blocked) {
+	if (pos.z >= MAP_MAX_LAYERS) {
+		return;
+	}
+
+	if (const auto sector = getMapSector(pos.x, pos.y)) {
+		if (const auto &floor = sector->getFloor(pos.z)) {
+			floor->setProjectileBlocked(pos.x, pos.y, blocked);
+		}
 	}
 }
 
@@ -459,108 +490,9 @@ bool Map::canThrowObjectTo(const Position &fromPos, const Position &toPos, const
 }
 
 bool Map::checkSightLine(Position start, Position destination) {
-	if (start.x == destination.x && start.y == destination.y) {
-		return true;
-	}
-
-	int32_t distanceX = Position::getDistanceX(start, destination);
-	int32_t distanceY = Position::getDistanceY(start, destination);
-
-	if (start.y == destination.y) {
-		// Horizontal line
-		const uint16_t delta = start.x < destination.x ? 0x0001 : 0xFFFF;
-		while (--distanceX > 0) {
-			start.x += delta;
-
-			const auto &tile = getTile(start.x, start.y, start.z);
-			if (tile && tile->hasProperty(CONST_PROP_BLOCKPROJECTILE)) {
-				return false;
-			}
-		}
-	} else if (start.x == destination.x) {
-		// Vertical line
-		const uint16_t delta = start.y < destination.y ? 0x0001 : 0xFFFF;
-		while (--distanceY > 0) {
-			start.y += delta;
-
-			const auto &tile = getTile(start.x, start.y, start.z);
-			if (tile && tile->hasProperty(CONST_PROP_BLOCKPROJECTILE)) {
-				return false;
-			}
-		}
-	} else {
-		// Xiaolin Wu's line algorithm - https://en.wikipedia.org/wiki/Xiaolin_Wu%27s_line_algorithm
-		// based on Michael Abrash's implementation - https://www.amazon.com/gp/product/1576101746/102-5103244-8168911
-		uint16_t eAdj;
-		uint16_t eAcc = 0;
-		uint16_t deltaX = 0x0001;
-		uint16_t deltaY = 0x0001;
-
-		if (distanceY > distanceX) {
-			eAdj = (static_cast<uint32_t>(distanceX) << 16) / static_cast<uint32_t>(distanceY);
-
-			if (start.y > destination.y) {
-				std::swap(start.x, destination.x);
-				std::swap(start.y, destination.y);
-			}
-			if (start.x > destination.x) {
-				deltaX = 0xFFFF;
-				eAcc -= eAdj;
-			}
-
-			while (--distanceY > 0) {
-				uint16_t xIncrease = 0;
-				const uint16_t eAccTemp = eAcc;
-				eAcc += eAdj;
-				if (eAcc <= eAccTemp) {
-					xIncrease = deltaX;
-				}
-
-				const auto &tile = getTile(start.x + xIncrease, start.y + deltaY, start.z);
-				if (tile && tile->hasProperty(CONST_PROP_BLOCKPROJECTILE)) {
-					if (Position::areInRange<1, 1>(start, destination)) {
-						return true;
-					}
-					return false;
-				}
-
-				start.x += xIncrease;
-				start.y += deltaY;
-			}
-		} else {
-			eAdj = (static_cast<uint32_t>(distanceY) << 16) / static_cast<uint32_t>(distanceX);
-
-			if (start.x > destination.x) {
-				std::swap(start.x, destination.x);
-				std::swap(start.y, destination.y);
-			}
-			if (start.y > destination.y) {
-				deltaY = 0xFFFF;
-				eAcc -= eAdj;
-			}
-
-			while (--distanceX > 0) {
-				uint16_t yIncrease = 0;
-				const uint16_t eAccTemp = eAcc;
-				eAcc += eAdj;
-				if (eAcc <= eAccTemp) {
-					yIncrease = deltaY;
-				}
-
-				const auto &tile = getTile(start.x + deltaX, start.y + yIncrease, start.z);
-				if (tile && tile->hasProperty(CONST_PROP_BLOCKPROJECTILE)) {
-					if (Position::areInRange<1, 1>(start, destination)) {
-						return true;
-					}
-					return false;
-				}
-
-				start.x += deltaX;
-				start.y += yIncrease;
-			}
-		}
-	}
-	return true;
+	return walkSightLine(start, destination, [this, z = start.z](uint16_t x, uint16_t y) {
+		return isProjectileBlocked(x, y, z);
+	});
 }
 
 bool Map::isSightClear(const Position &fromPos, const Position &toPos, bool floorCheck) {
@@ -120,6 +120,13 @@ public:
 	bool isSightClear(const Position &fromPos, const Position &toPos, bool floorCheck);
 	bool checkSightLine(Position start, Position destination);
 
+	/**
+	 * Projectile-blocking state of a position, kept per floor of each sector.
+	 * Reading it neither locks the floor nor loads the tile from the map cache.
+	 */
+	bool isProjectileBlocked(uint16_t x, uint16_t y, uint8_t z) const;
+	void setProjectileBlocked(const Position &pos, bool blocked);
+
 	std::shared_ptr<Tile> canWalkTo(const std::shared_ptr<Creature> &creature, const Position &pos);
 
 	bool getPathMatching(const std::shared_ptr<Creature> &creature, std::vector<Direction> &dirList, const FrozenPathingConditionCall &pathCondition, const FindPathParams &fpp);
@@ -26,6 +26,9 @@
 
 static phmap::flat_hash_map<size_t, std::shared_ptr<BasicItem>> items;
 static phmap::flat_hash_map<size_t, std::shared_ptr<BasicTile>> tiles;
+// Positions and item references of the map being loaded, to report what sharing the layouts saved
+static size_t cachedPositions = 0;
+static size_t cachedItemReferences = 0;
 
 std::shared_ptr<BasicItem> static_tryGetItemFromCache(const std::shared_ptr<BasicItem> &ref) {
 	return ref ? items.try_emplace(ref->hash(), ref).first->second : nullptr;
@@ -36,8 +39,17 @@ std::shared_ptr<BasicTile> static_tryGetTileFromCache(const std::shared_ptr<Basi
 }
 
 void MapCache::flush() {
+	if (cachedPositions > 0) {
+		// Estimates: what the shared layouts take against one tile object and one item object per position
+		const size_t sharedBytes = tiles.size() * sizeof(BasicTile) + items.size() * sizeof(BasicItem);
+		const size_t materializedBytes = cachedPositions * sizeof(DynamicTile) + cachedItemReferences * sizeof(Item);
+		g_logger().info("Map tile cache: {} tiles share {} tile and {} item layouts, ~{} MB kept instead of ~{} MB of materialized tiles", cachedPositions, tiles.size(), items.size(), sharedBytes / (1024 * 1024), materializedBytes / (1024 * 1024));
+	}
+
 	items.clear();
 	tiles.clear();
+	cachedPositions = 0;
+	cachedItemReferences = 0;
 }
 
 void MapCache::parseItemAttr(const std::shared_ptr<BasicItem> &BasicItem, std::shared_ptr<Item> item) {
@@ -110,6 +122,12 @@ std::shared_ptr<Tile> MapCache::getOrCreateTileFromCache(const std::unique_ptr<F
 
 	std::unique_lock l(floor->getMutex());
 
+	// Another thread may have promoted the tile while we waited for the lock
+	const auto &[currentTile, currentCache] = floor->getTiles()[x & SECTOR_MASK][y & SECTOR_MASK];
+	if (!currentCache) {
+		return currentTile;
+	}
+
 	const uint8_t z = floor->getZ();
 
 	auto map = static_cast<Map*>(this);
@@ -159,11 +177,25 @@ void MapCache::setBasicTile(uint16_t x, uint16_t y, uint8_t z, const std::shared
 	}
 
 	const auto tile = static_tryGetTileFromCache(newTile);
-	if (const auto sector = getMapSector(x, y)) {
-		sector->createFloor(z)->setTileCache(x, y, tile);
-	} else {
-		getBestMapSector(x, y)->createFloor(z)->setTileCache(x, y, tile);
+	if (tile) {
+		++cachedPositions;
+		cachedItemReferences += (tile->ground ? 1 : 0) + tile->items.size();
 	}
+
+	const auto &floor = [&]() -> const std::unique_ptr<Floor> & {
+		if (const auto sector = getMapSector(x, y)) {
+			return sector->createFloor(z);
+		}
+		return getBestMapSector(x, y)->createFloor(z);
+	}();
+
+	floor->setTileCache(x, y, tile);
+
+	// The tile stays cached until something touches it, sight checks must see its walls already
+	const auto blocksProjectile = [](const std::shared_ptr<BasicItem> &item) {
+		return item && Item::items[item->id].blockProjectile;
+	};
+	floor->setProjectileBlocked(x, y, tile && (blocksProjectile(tile->ground) || std::ranges::any_of(tile->items, blocksProjectile)));
 }
 
 std::shared_ptr<BasicItem> MapCache::tryReplaceItemFromCache(const std::shared_ptr<BasicItem> &ref) {
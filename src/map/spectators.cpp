@@ -18,26 +18,15 @@ void Spectators::clearCache() {
 	spectatorsCache.clear();
 }
 
-Spectators Spectators::insert(const std::shared_ptr<Creature> &creature) {
+Spectators &Spectators::insert(const std::shared_ptr<Creature> &creature) {
 	if (creature) {
 		creatures.emplace_back(creature);
 	}
 	return *this;
 }
 
-Spectators Spectators::insertAll(const CreatureVector &list) {
-	if (!list.empty()) {
-		const bool hasValue = !creatures.empty();
-
-		creatures.insert(creatures.end(), list.begin(), list.end());
-
-		// Remove duplicate
-		if (hasValue) {
-			std::unordered_set uset(creatures.begin(), creatures.end());
-			creatures.clear();
-			creatures.insert(creatures.end(), uset.begin(), uset.end());
-		}
-	}
+Spectators &Spectators::insertAll(const CreatureVector &list) {
+	append(list, [](const auto &) { return true; });
 	return *this;
 }
 
@@ -54,20 +43,15 @@ bool Spectators::checkCache(const SpectatorsCache::FloorData &specData, bool onl
 	}
 
 	if (checkDistance) {
-		CreatureVector spectators;
-		spectators.reserve(creatures.size());
-		for (const auto &creature : *list) {
+		append(*list, [&](const std::shared_ptr<Creature> &creature) {
 			const auto &specPos = creature->getPosition();
-			if (centerPos.x - specPos.x >= minRangeX
-			    && centerPos.y - specPos.y >= minRangeY
-			    && centerPos.x - specPos.x <= maxRangeX
-			    && centerPos.y - specPos.y <= maxRangeY
-			    && (multifloor || specPos.z == centerPos.z)
-			    && (!onlyPlayers || creature->getPlayer())) {
-				spectators.emplace_back(creature);
-			}
-		}
-		insertAll(spectators);
+			return centerPos.x - specPos.x >= minRangeX
+				&& centerPos.y - specPos.y >= minRangeY
+				&& centerPos.x - specPos.x <= maxRangeX
+				&& centerPos.y - specPos.y <= maxRangeY
+				&& (multifloor || specPos.z == centerPos.z)
+				&& (!onlyPlayers || creature->getPlayer());
+		});
 	} else {
 		insertAll(*list);
 	}
@@ -75,7 +59,7 @@ bool Spectators::checkCache(const SpectatorsCache::FloorData &specData, bool onl
 	return true;
 }
 
-Spectators Spectators::find(const Position &centerPos, bool multifloor, bool onlyPlayers, int32_t minRangeX, int32_t maxRangeX, int32_t minRangeY, int32_t maxRangeY) {
+void Spectators::find(const Position &centerPos, bool multifloor, bool onlyPlayers, int32_t minRangeX, int32_t maxRangeX, int32_t minRangeY, int32_t maxRangeY) {
 	minRangeX = (minRangeX == 0 ? -MAP_MAX_VIEW_PORT_X : -minRangeX);
 	maxRangeX = (maxRangeX == 0 ? MAP_MAX_VIEW_PORT_X : maxRangeX);
 	minRangeY = (minRangeY == 0 ? -MAP_MAX_VIEW_PORT_Y : -minRangeY);
@@ -97,17 +81,17 @@ Spectators Spectators::find(const Position &centerPos, bool multifloor, bool onl
 			if (onlyPlayers) {
 				// check players cache
 				if (checkCache(cache.players, true, centerPos, checkDistance, multifloor, minRangeX, maxRangeX, minRangeY, maxRangeY)) {
-					return *this;
+					return;
 				}
 
 				// if there is no player cache, look for players in the creatures cache.
 				if (checkCache(cache.creatures, true, centerPos, true, multifloor, minRangeX, maxRangeX, minRangeY, maxRangeY)) {
-					return *this;
+					return;
 				}
 
 				// All Creatures
 			} else if (checkCache(cache.creatures, false, centerPos, checkDistance, multifloor, minRangeX, maxRangeX, minRangeY, maxRangeY)) {
-				return *this;
+				return;
 			}
 		}
 	}
@@ -200,6 +184,4 @@ Spectators Spectators::find(const Position &centerPos, bool multifloor, bool onl
 
 		creatureList->insert(creatureList->end(), spectators.begin(), spectators.end());
 	}
-
-	return *this;
 }
@@ -31,24 +31,35 @@ struct SpectatorsCache {
 	FloorData players;
 };
 
+// find, insert and join return the same object: a temporary is moved along the chain
+// and an lvalue is returned by reference, so no query copies its creature list.
 class Spectators {
 public:
 	static void clearCache();
 
 	template <typename T>
 		requires std::is_same_v<Creature, T> || std::is_same_v<Player, T>
-	Spectators find(const Position &centerPos, bool multifloor = false, int32_t minRangeX = 0, int32_t maxRangeX = 0, int32_t minRangeY = 0, int32_t maxRangeY = 0) {
+	Spectators &find(const Position &centerPos, bool multifloor = false, int32_t minRangeX = 0, int32_t maxRangeX = 0, int32_t minRangeY = 0, int32_t maxRangeY = 0) & {
 		constexpr bool onlyPlayers = std::is_same_v<T, Player>;
-		return find(centerPos, multifloor, onlyPlayers, minRangeX, maxRangeX, minRangeY, maxRangeY);
+		find(centerPos, multifloor, onlyPlayers, minRangeX, maxRangeX, minRangeY, maxRangeY);
+		return *this;
+	}
+
+	template <typename T>
+		requires std::is_same_v<Creature, T> || std::is_same_v<Player, T>
+	Spectators find(const Position &centerPos, bool multifloor = false, int32_t minRangeX = 0, int32_t maxRangeX = 0, int32_t minRangeY = 0, int32_t maxRangeY = 0) && {
+		constexpr bool onlyPlayers = std::is_same_v<T, Player>;
+		find(centerPos, multifloor, onlyPlayers, minRangeX, maxRangeX, minRangeY, maxRangeY);
+		return std::move(*this);
 	}
 
 	template <typename T>
 		requires std::is_base_of_v<Creature, T>
-	Spectators filter();
+	Spectators filter() const;
 
-	Spectators insert(const std::shared_ptr<Creature> &creature);
-	Spectators insertAll(const CreatureVector &list);
-	Spectators join(const Spectators &anotherSpectators) {
+	Spectators &insert(const std::shared_ptr<Creature> &creature);
+	Spectators &insertAll(const CreatureVector &list);
+	Spectators &join(const Spectators &anotherSpectators) {
 		return insertAll(anotherSpectators.creatures);
 	}
 
@@ -83,15 +94,21 @@ public:
 private:
 	static phmap::flat_hash_map<Position, SpectatorsCache> spectatorsCache;
 
-	Spectators find(const Position &centerPos, bool multifloor = false, bool onlyPlayers = false, int32_t minRangeX = 0, int32_t maxRangeX = 0, int32_t minRangeY = 0, int32_t maxRangeY = 0);
+	void find(const Position &centerPos, bool multifloor = false, bool onlyPlayers = false, int32_t minRangeX = 0, int32_t maxRangeX = 0, int32_t minRangeY = 0, int32_t maxRangeY = 0);
 	bool checkCache(const SpectatorsCache::FloorData &specData, bool onlyPlayers, const Position &centerPos, bool checkDistance, bool multifloor, int32_t minRangeX, int32_t maxRangeX, int32_t minRangeY, int32_t maxRangeY);
+	/**
+	 * Appends the creatures accepted by the filter, skipping the ones already in the list.
+	 * The current order is kept and only raw pointers are hashed, no shared_ptr is copied for the check.
+	 */
+	template <typename Filter>
+	void append(const CreatureVector &list, const Filter &accept);
 
 	CreatureVector creatures;
 };
 
 template <typename T>
 	requires std::is_base_of_v<Creature, T>
-Spectators Spectators::filter() {
+Spectators Spectators::filter() const {
 	auto specs = Spectators();
 	specs.creatures.reserve(creatures.size());
 
@@ -113,3 +130,28 @@ Spectators Spectators::filter() {
 
 	return specs;
 }
+
+template <typename Filter>
+void Spectators::append(const CreatureVector &list, const Filter &accept) {
+	if (creatures.empty()) {
+		creatures.reserve(list.size());
+		for (const auto &creature : list) {
+			if (accept(creature)) {
+				creatures.emplace_back(creature);
+			}
+		}
+		return;
+	}
+
+	phmap::flat_hash_set<const Creature*> present;
+	present.reserve(creatures.size() + list.size());
+	for (const auto &creature : creatures) {
+		present.emplace(creature.get());
+	}
+
+	for (const auto &creature : list) {
+		if (accept(creature) && present.emplace(creature.get()).second) {
+			creatures.emplace_back(creature);
+		}
+	}
+}
@@ -37,6 +37,20 @@ struct Floor {
 		tiles[x & SECTOR_MASK][y & SECTOR_MASK].second = newTile;
 	}
 
+	// Lock-free, and known for cached tiles too, so sight lines never materialize tiles
+	bool isProjectileBlocked(uint16_t x, uint16_t y) const {
+		return projectileBlocked[y & SECTOR_MASK].load(std::memory_order_relaxed) & (1u << (x & SECTOR_MASK));
+	}
+
+	void setProjectileBlocked(uint16_t x, uint16_t y, bool blocked) {
+		const uint32_t bit = 1u << (x & SECTOR_MASK);
+		if (blocked) {
+			projectileBlocked[y & SECTOR_MASK].fetch_or(bit, std::memory_order_relaxed);
+		} else {
+			projectileBlocked[y & SECTOR_MASK].fetch_and(~bit, std::memory_order_relaxed);
+		}
+	}
+
 	const auto &getTiles() const {
 		return tiles;
 	}
@@ -50,7 +64,11 @@ struct Floor {
 	}
 
 private:
+	static_assert(SECTOR_SIZE <= 32, "projectileBlocked keeps a row of the sector in 32 bits");
+
 	std::pair<std::shared_ptr<Tile>, std::shared_ptr<BasicTile>> tiles[SECTOR_SIZE][SECTOR_SIZE] = {};
+	// One bit per tile that blocks projectiles, one word per row
+	std::atomic<uint32_t> projectileBlocked[SECTOR_SIZE] = {};
 	mutable std::shared_mutex mutex;
 	uint8_t z { 0 };
 };
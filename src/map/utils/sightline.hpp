@@ -0,0 +1,122 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "game/movement/position.hpp"
+
+/**
+ * Walks the straight line between two positions of the same floor and asks
+ * isBlocked(x, y) for every cell strictly between them.
+ * The walk is shared by the map (tile lookups) and by area combat (a local
+ * projectile-blocking bitmap), so both always agree on what is in sight.
+ *	\param isBlocked callable (uint16_t x, uint16_t y) -> bool, true if the cell blocks projectiles
+ *	\returns true if no cell in between blocks the line
+ */
+template <typename BlockedCheck>
+bool walkSightLine(Position start, Position destination, const BlockedCheck &isBlocked) {
+	if (start.x == destination.x && start.y == destination.y) {
+		return true;
+	}
+
+	int32_t distanceX = Position::getDistanceX(start, destination);
+	int32_t distanceY = Position::getDistanceY(start, destination);
+
+	if (start.y == destination.y) {
+		// Horizontal line
+		const uint16_t delta = start.x < destination.x ? 0x0001 : 0xFFFF;
+		while (--distanceX > 0) {
+			start.x += delta;
+
+			if (isBlocked(start.x, start.y)) {
+				return false;
+			}
+		}
+	} else if (start.x == destination.x) {
+		// Vertical line
+		const uint16_t delta = start.y < destination.y ? 0x0001 : 0xFFFF;
+		while (--distanceY > 0) {
+			start.y += delta;
+
+			if (isBlocked(start.x, start.y)) {
+				return false;
+			}
+		}
+	} else {
+		// Xiaolin Wu's line algorithm - https://en.wikipedia.org/wiki/Xiaolin_Wu%27s_line_algorithm
+		// based on Michael Abrash's implementation - https://www.amazon.com/gp/product/1576101746/102-5103244-8168911
+		uint16_t eAdj;
+		uint16_t eAcc = 0;
+		uint16_t deltaX = 0x0001;
+		uint16_t deltaY = 0x0001;
+
+		if (distanceY > distanceX) {
+			eAdj = (static_cast<uint32_t>(distanceX) << 16) / static_cast<uint32_t>(distanceY);
+
+			if (start.y > destination.y) {
+				std::swap(start.x, destination.x);
+				std::swap(start.y, destination.y);
+			}
+			if (start.x > destination.x) {
+				deltaX = 0xFFFF;
+				eAcc -= eAdj;
+			}
+
+			while (--distanceY > 0) {
+				uint16_t xIncrease = 0;
+				const uint16_t eAccTemp = eAcc;
+				eAcc += eAdj;
+				if (eAcc <= eAccTemp) {
+					xIncrease = deltaX;
+				}
+
+				if (isBlocked(static_cast<uint16_t>(start.x + xIncrease), static_cast<uint16_t>(start.y + deltaY))) {
+					if (Position::areInRange<1, 1>(start, destination)) {
+						return true;
+					}
+					return false;
+				}
+
+				start.x += xIncrease;
+				start.y += deltaY;
+			}
+		} else {
+			eAdj = (static_cast<uint32_t>(distanceY) << 16) / static_cast<uint32_t>(distanceX);
+
+			if (start.x > destination.x) {
+				std::swap(start.x, destination.x);
+				std::swap(start.y, destination.y);
+			}
+			if (start.y > destination.y) {
+				deltaY = 0xFFFF;
+				eAcc -= eAdj;
+			}
+
+			while (--distanceX > 0) {
+				uint16_t yIncrease = 0;
+				const uint16_t eAccTemp = eAcc;
+				eAcc += eAdj;
+				if (eAcc <= eAccTemp) {
+					yIncrease = deltaY;
+				}
+
+				if (isBlocked(static_cast<uint16_t>(start.x + deltaX), static_cast<uint16_t>(start.y + yIncrease))) {
+					if (Position::areInRange<1, 1>(start, destination)) {
+						return true;
+					}
+					return false;
+				}
+
+				start.x += deltaX;
+				start.y += yIncrease;
+			}
+		}
+	}
+	return true;
+}
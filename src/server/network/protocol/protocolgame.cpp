@@ -35,6 +35,7 @@
 #include "game/scheduling/dispatcher.hpp"
 #include "creatures/combat/spells.hpp"
 #include "utils/tools.hpp"
+#include "lib/metrics/metrics.hpp"
 #include "creatures/players/management/waitlist.hpp"
 #include "items/weapons/weapons.hpp"
 #include "enums/object_category.hpp"
@@ -1390,6 +1391,31 @@ void ProtocolGame::GetTileDescription(std::shared_ptr<Tile> tile, NetworkMessage
 		msg.add<uint16_t>(0x00); // Env effects
 	}
 
+	// Creatures depend on who is looking (visibility, known list), so only item-only tiles share the cached encoding
+	const CreatureVector* creatures = tile->getCreatures();
+	if (creatures && !creatures->empty()) {
+		GetTileThingsDescription(tile, msg);
+		return;
+	}
+
+	if (const std::string* description = tile->getItemsDescription(oldProtocol)) {
+		if (!description->empty()) {
+			msg.addBytes(description->data(), description->size());
+		}
+		return;
+	}
+
+	const auto startPosition = msg.getBufferPosition();
+	GetTileThingsDescription(tile, msg);
+
+	// A nearly full message may have dropped part of the encoding, never cache it then
+	const auto endPosition = msg.getBufferPosition();
+	if (endPosition + TILE_DESCRIPTION_MAX_ITEM_SIZE < MAX_BODY_LENGTH && tile->canCacheItemsDescription()) {
+		tile->setItemsDescription(oldProtocol, std::string(reinterpret_cast<const char*>(msg.getBuffer()) + startPosition, endPosition - startPosition));
+	}
+}
+
+void ProtocolGame::GetTileThingsDescription(const std::shared_ptr<Tile> &tile, NetworkMessage &msg) {
 	int32_t count;
 	std::shared_ptr<Item> ground = tile->getGround();
 	if (ground) {
@@ -1500,45 +1526,42 @@ void ProtocolGame::GetFloorDescription(NetworkMessage &msg, int32_t x, int32_t y
 }
 
 void ProtocolGame::checkCreatureAsKnown(uint32_t id, bool &known, uint32_t &removedKnown) {
-	if (auto [creatureKnown, creatureInserted] = knownCreatureSet.insert(id);
-	    !creatureInserted) {
+	if (knownCreatureSet.touch(id)) {
 		known = true;
 		return;
 	}
+
 	known = false;
-	if (knownCreatureSet.size() > 1300) {
-		// Look for a creature to remove
-		for (auto it = knownCreatureSet.begin(), end = knownCreatureSet.end(); it != end; ++it) {
-			if (*it == id) {
-				continue;
-			}
-			// We need to protect party players from removing
-			std::shared_ptr<Creature> creature = g_game().getCreatureByID(*it);
-			if (std::shared_ptr<Player> checkPlayer;
-			    creature && (checkPlayer = creature->getPlayer()) != nullptr) {
-				if (player->getParty() != checkPlayer->getParty() && !canSee(creature)) {
-					removedKnown = *it;
-					knownCreatureSet.erase(it);
-					return;
-				}
-			} else if (!canSee(creature)) {
-				removedKnown = *it;
-				knownCreatureSet.erase(it);
-				return;
+	removedKnown = 0;
+	if (knownCreatureSet.size() >= MAX_KNOWN_CREATURES) {
+		// Candidates come from the least recently described end; creatures we can still see or
+		// party members get a second chance at the front, so the usual case stops after a few probes
+		const size_t probes = knownCreatureSet.size();
+		for (size_t probe = 0; probe < probes; ++probe) {
+			const uint32_t candidate = knownCreatureSet.back();
+			const auto &creature = g_game().getCreatureByID(candidate);
+			const auto &checkPlayer = creature ? creature->getPlayer() : nullptr;
+			const bool sameParty = checkPlayer && player->getParty() && player->getParty() == checkPlayer->getParty();
+			if (!sameParty && !canSee(creature)) {
+				removedKnown = candidate;
+				break;
 			}
+			knownCreatureSet.touch(candidate);
 		}
 
-		// Bad situation. Let's just remove anyone.
-		auto it = knownCreatureSet.begin();
-		if (*it == id) {
-			++it;
+		// Bad situation, every known creature was checked. Let's just remove the least recently described one.
+		if (removedKnown == 0) {
+			removedKnown = knownCreatureSet.back();
 		}
 
-		removedKnown = *it;
-		knownCreatureSet.erase(it);
-	} else {
-		removedKnown = 0;
+		knownCreatureSet.erase(removedKnown);
+		++knownCreatureEvictions;
+
+		static const auto evictionsCounter = g_metrics().counter("known_creature_evictions");
+		evictionsCounter.add(1);
 	}
+
+	knownCreatureSet.insert(id);
 }
 
 bool ProtocolGame::canSee(std::shared_ptr<Creature> c) const {
@@ -2308,7 +2331,7 @@ void ProtocolGame::parseBestiarysendRaces() {
 	NetworkMessage msg;
 	msg.addByte(0xd5);
 	msg.add<uint16_t>(BESTY_RACE_LAST);
-	std::map<uint16_t, std::string> mtype_list = g_game().getBestiaryList();
+	const auto &mtype_list = g_game().getBestiaryList();
 	for (uint8_t i = BESTY_RACE_FIRST; i <= BESTY_RACE_LAST; i++) {
 		std::string BestClass = "";
 		uint16_t count = 0;
@@ -2351,7 +2374,7 @@ void ProtocolGame::parseBestiarysendMonsterData(NetworkMessage &msg) {
 	uint16_t raceId = msg.get<uint16_t>();
 	std::string Class = "";
 	std::shared_ptr<MonsterType> mtype = nullptr;
-	std::map<uint16_t, std::string> mtype_list = g_game().getBestiaryList();
+	const auto &mtype_list = g_game().getBestiaryList();
 
 	auto ait = mtype_list.find(raceId);
 	if (ait != mtype_list.end()) {
@@ -2489,7 +2512,7 @@ void ProtocolGame::parseCyclopediaMonsterTracker(NetworkMessage &msg) {
 	}
 
 	// Bestiary tracker logic
-	const auto bestiaryMonsters = g_game().getBestiaryList();
+	const auto &bestiaryMonsters = g_game().getBestiaryList();
 	auto it = bestiaryMonsters.find(monsterRaceId);
 	if (it != bestiaryMonsters.end()) {
 		const auto mtype = g_monsters().getMonsterType(it->second);
@@ -2962,7 +2985,7 @@ void ProtocolGame::parseBestiarysendCreatures(NetworkMessage &msg) {
 
 	if (search == 1) {
 		uint16_t monsterAmount = msg.get<uint16_t>();
-		std::map<uint16_t, std::string> mtype_list = g_game().getBestiaryList();
+		const auto &mtype_list = g_game().getBestiaryList();
 		for (uint16_t monsterCount = 1; monsterCount <= monsterAmount; monsterCount++) {
 			uint16_t raceid = msg.get<uint16_t>();
 			if (player->getBestiaryKillCount(raceid) > 0) {
@@ -6014,54 +6037,36 @@ void ProtocolGame::sendMarketDetail(uint16_t itemId, uint8_t tier) {
 		}
 	}
 
-	const auto &purchaseStatsMap = IOMarket::getInstance().getPurchaseStatistics();
-	auto purchaseIterator = purchaseStatsMap.find(itemId);
-	if (purchaseIterator != purchaseStatsMap.end()) {
-		const auto &tierStatsMap = purchaseIterator->second;
-		auto tierStatsIter = tierStatsMap.find(tier);
-		if (tierStatsIter != tierStatsMap.end()) {
-			const auto &purchaseStatistics = tierStatsIter->second;
-			msg.addByte(0x01);
-			msg.add<uint32_t>(purchaseStatistics.numTransactions);
-			if (oldProtocol) {
-				msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), purchaseStatistics.totalPrice));
-				msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), purchaseStatistics.highestPrice));
-				msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), purchaseStatistics.lowestPrice));
-			} else {
-				msg.add<uint64_t>(purchaseStatistics.totalPrice);
-				msg.add<uint64_t>(purchaseStatistics.highestPrice);
-				msg.add<uint64_t>(purchaseStatistics.lowestPrice);
-			}
+	if (const auto* purchaseStatistics = IOMarket::getInstance().getPurchaseStatistics(itemId, tier)) {
+		msg.addByte(0x01);
+		msg.add<uint32_t>(purchaseStatistics->numTransactions);
+		if (oldProtocol) {
+			msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), purchaseStatistics->totalPrice));
+			msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), purchaseStatistics->highestPrice));
+			msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), purchaseStatistics->lowestPrice));
 		} else {
-			msg.addByte(0x00);
+			msg.add<uint64_t>(purchaseStatistics->totalPrice);
+			msg.add<uint64_t>(purchaseStatistics->highestPrice);
+			msg.add<uint64_t>(purchaseStatistics->lowestPrice);
 		}
 	} else {
-		msg.addByte(0x00); // send to old protocol ?
+		msg.addByte(0x00);
 	}
 
-	const auto &saleStatsMap = IOMarket::getInstance().getSaleStatistics();
-	auto saleIterator = saleStatsMap.find(itemId);
-	if (saleIterator != saleStatsMap.end()) {
-		const auto &tierStatsMap = saleIterator->second;
-		auto tierStatsIter = tierStatsMap.find(tier);
-		if (tierStatsIter != tierStatsMap.end()) {
-			const auto &saleStatistics = tierStatsIter->second;
-			msg.addByte(0x01);
-			msg.add<uint32_t>(saleStatistics.numTransactions);
-			if (oldProtocol) {
-				msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), saleStatistics.totalPrice));
-				msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), saleStatistics.highestPrice));
-				msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), saleStatistics.lowestPrice));
-			} else {
-				msg.add<uint64_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), saleStatistics.totalPrice));
-				msg.add<uint64_t>(saleStatistics.highestPrice);
-				msg.add<uint64_t>(saleStatistics.lowestPrice);
-			}
+	if (const auto* saleStatistics = IOMarket::getInstance().getSaleStatistics(itemId, tier)) {
+		msg.addByte(0x01);
+		msg.add<uint32_t>(saleStatistics->numTransactions);
+		if (oldProtocol) {
+			msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), saleStatistics->totalPrice));
+			msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), saleStatistics->highestPrice));
+			msg.add<uint32_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), saleStatistics->lowestPrice));
 		} else {
-			msg.addByte(0x00);
+			msg.add<uint64_t>(std::min<uint64_t>(std::numeric_limits<uint32_t>::max(), saleStatistics->totalPrice));
+			msg.add<uint64_t>(saleStatistics->highestPrice);
+			msg.add<uint64_t>(saleStatistics->lowestPrice);
 		}
 	} else {
-		msg.addByte(0x00); // send to old protocol ?
+		msg.addByte(0x00);
 	}
 
 	writeToOutputBuffer(msg);
@@ -7527,9 +7532,9 @@ void ProtocolGame::sendPreyData(const std::unique_ptr<PreySlot> &slot) {
 			msg.addByte(outfit.lookAddons);
 		}
 	} else if (slot->state == PreyDataState_ListSelection) {
-		const std::map<uint16_t, std::string> bestiaryList = g_game().getBestiaryList();
+		const auto &bestiaryList = g_game().getBestiaryList();
 		msg.add<uint16_t>(static_cast<uint16_t>(bestiaryList.size()));
-		std::for_each(bestiaryList.begin(), bestiaryList.end(), [&msg](auto mType) {
+		std::for_each(bestiaryList.begin(), bestiaryList.end(), [&msg](const auto &mType) {
 			msg.add<uint16_t>(mType.first);
 		});
 	} else {
@@ -8137,9 +8142,9 @@ void ProtocolGame::sendTaskHuntingData(const std::unique_ptr<TaskHuntingSlot> &s
 		});
 	} else if (slot->state == PreyTaskDataState_ListSelection) {
 		std::shared_ptr<Player> user = player;
-		const std::map<uint16_t, std::string> bestiaryList = g_game().getBestiaryList();
+		const auto &bestiaryList = g_game().getBestiaryList();
 		msg.add<uint16_t>(static_cast<uint16_t>(bestiaryList.size()));
-		std::for_each(bestiaryList.begin(), bestiaryList.end(), [&msg, user](auto mType) {
+		std::for_each(bestiaryList.begin(), bestiaryList.end(), [&msg, user](const auto &mType) {
 			msg.add<uint16_t>(mType.first);
 			msg.addByte(user->isCreatureUnlockedOnTaskHunting(g_monsters().getMonsterType(mType.second)) ? 0x01 : 0x00);
 		});
@@ -8425,15 +8430,14 @@ void ProtocolGame::sendItemsPrice() {
 	auto countBuffer = msg.getBufferPosition();
 	uint16_t count = 0;
 	msg.skipBytes(2);
-	for (const auto &[itemId, tierAndPriceMap] : g_game().getItemsPrice()) {
-		for (const auto &[tier, price] : tierAndPriceMap) {
-			msg.add<uint16_t>(itemId);
-			if (Item::items[itemId].upgradeClassification > 0) {
-				msg.addByte(tier);
-			}
-			msg.add<uint64_t>(price);
-			count++;
+	for (const auto &[key, price] : g_game().getItemsPrice()) {
+		const auto itemId = static_cast<uint16_t>(key >> 8);
+		msg.add<uint16_t>(itemId);
+		if (Item::items[itemId].upgradeClassification > 0) {
+			msg.addByte(static_cast<uint8_t>(key & 0xFF));
 		}
+		msg.add<uint64_t>(price);
+		count++;
 	}
 	msg.setBufferPosition(countBuffer);
 	msg.add<uint16_t>(count);
@@ -8787,7 +8791,7 @@ void ProtocolGame::parseSendBosstiary() {
 	NetworkMessage msg;
 	msg.addByte(0x73);
 
-	auto mtype_map = g_ioBosstiary().getBosstiaryMap();
+	const auto &mtype_map = g_ioBosstiary().getBosstiaryMap();
 	auto bossesBuffer = msg.getBufferPosition();
 	uint16_t bossesCount = 0;
 	msg.skipBytes(2);
@@ -9086,8 +9090,7 @@ void ProtocolGame::sendBosstiaryCooldownTimer() {
 	auto startBosses = msg.getBufferPosition();
 	msg.skipBytes(2); // Boss count
 	uint16_t bossesCount = 0;
-	for (std::map<uint16_t, std::string> bossesMap = g_ioBosstiary().getBosstiaryMap();
-	     const auto &[bossRaceId, _] : bossesMap) {
+	for (const auto &[bossRaceId, _] : g_ioBosstiary().getBosstiaryMap()) {
 		const auto mType = g_ioBosstiary().getMonsterTypeByBossRaceId(bossRaceId);
 		if (!mType) {
 			continue;
@@ -16,6 +16,7 @@
 #include "creatures/players/cyclopedia/player_badge.hpp"
 #include "creatures/players/cyclopedia/player_cyclopedia.hpp"
 #include "creatures/players/cyclopedia/player_title.hpp"
+#include "utils/lru_set.hpp"
 
 class NetworkMessage;
 class Player;
@@ -78,6 +79,10 @@ public:
 		return version;
 	}
 
+	uint32_t getKnownCreatureEvictions() const {
+		return knownCreatureEvictions;
+	}
+
 private:
 	ProtocolGame_ptr getThis() {
 		return std::static_pointer_cast<ProtocolGame>(shared_from_this());
@@ -432,6 +437,7 @@ private:
 	// Help functions
 	// translate a tile to clientreadable format
 	void GetTileDescription(std::shared_ptr<Tile> tile, NetworkMessage &msg);
+	void GetTileThingsDescription(const std::shared_ptr<Tile> &tile, NetworkMessage &msg);
 
 	// translate a floor to clientreadable format
 	void GetFloorDescription(NetworkMessage &msg, int32_t x, int32_t y, int32_t z, int32_t width, int32_t height, int32_t offset, int32_t &skip);
@@ -485,7 +491,10 @@ private:
 	friend class PlayerWheel;
 	friend class PlayerVIP;
 
-	std::unordered_set<uint32_t> knownCreatureSet;
+	// The client keeps at most MAX_KNOWN_CREATURES creatures cached, ordered here by the last time we described them
+	static constexpr size_t MAX_KNOWN_CREATURES = 1300;
+	stdext::lru_set<uint32_t> knownCreatureSet { MAX_KNOWN_CREATURES + 1 };
+	uint32_t knownCreatureEvictions = 0;
 	std::shared_ptr<Player> player = nullptr;
 
 	uint32_t eventConnect = 0;
@@ -18,6 +18,22 @@
 #include "game/game.hpp"
 #include "core.hpp"
 #include "enums/account_errors.hpp"
+#include "lib/metrics/metrics.hpp"
+#include "lib/thread/thread_pool.hpp"
+
+std::atomic<uint32_t> ProtocolLogin::pendingLogins = 0;
+
+namespace {
+	BS::thread_pool &loginWorkers() {
+		static BS::thread_pool pool(std::max<int32_t>(1, g_configManager().getNumber(LOGIN_WORKER_THREADS, __FUNCTION__)));
+		return pool;
+	}
+
+	const metrics::UpDownCounterHandle &loginQueueDepth() {
+		static const auto handle = g_metrics().upDownCounter("login_queue_depth");
+		return handle;
+	}
+}
 
 void ProtocolLogin::disconnectClient(const std::string &message) {
 	auto output = OutputMessagePool::getOutputMessage();
@@ -41,7 +57,10 @@ void ProtocolLogin::getCharacterList(const std::string &accountDescriptor, const
 		return;
 	}
 
-	if (account.load() != enumToValue(AccountErrors_t::Ok) || !account.authenticate(password)) {
+	metrics::login_latency authLatency("authenticate");
+	const bool authenticated = account.load() == enumToValue(AccountErrors_t::Ok) && account.authenticate(password);
+	authLatency.stop();
+	if (!authenticated) {
 		std::ostringstream ss;
 		ss << (oldProtocol ? "Username" : "Email") << " or password is not correct.";
 		disconnectClient(ss.str());
@@ -105,6 +124,33 @@ void ProtocolLogin::onRecvFirstMessage(NetworkMessage &msg) {
 		return;
 	}
 
+	// Without the XTEA key (inside the RSA block) we can't answer with an error, so overflow is simply dropped
+	const auto maxDepth = static_cast<uint32_t>(g_configManager().getNumber(LOGIN_QUEUE_MAX_DEPTH, __FUNCTION__));
+	if (pendingLogins.fetch_add(1) >= maxDepth) {
+		--pendingLogins;
+		static const auto loginRejected = g_metrics().counter("login_rejected");
+		loginRejected.add(1);
+		g_logger().debug("[ProtocolLogin::onRecvFirstMessage] - Login queue is full ({} pending), dropping connection", maxDepth);
+		disconnect();
+		return;
+	}
+
+	loginQueueDepth().add(1);
+	// The connection reuses its buffer for the next read, so the worker gets its own copy
+	auto message = std::make_shared<NetworkMessage>(msg);
+	auto queueLatency = std::make_shared<metrics::login_latency>("queue");
+	loginWorkers().detach_task([self = std::static_pointer_cast<ProtocolLogin>(shared_from_this()), message, queueLatency] {
+		queueLatency->stop();
+		loginQueueDepth().add(-1);
+		{
+			metrics::login_latency measure("total");
+			self->processFirstMessage(*message);
+		}
+		--pendingLogins;
+	});
+}
+
+void ProtocolLogin::processFirstMessage(NetworkMessage &msg) {
 	msg.skipBytes(2); // client OS
 
 	uint16_t version = msg.get<uint16_t>();
@@ -120,11 +166,13 @@ void ProtocolLogin::onRecvFirstMessage(NetworkMessage &msg) {
 	 - 1 byte: preview world(971+)
 	 */
 
+	metrics::login_latency rsaLatency("rsa");
 	if (!Protocol::RSA_decrypt(msg)) {
 		g_logger().warn("[ProtocolLogin::onRecvFirstMessage] - RSA Decrypt Failed");
 		disconnect();
 		return;
 	}
+	rsaLatency.stop();
 
 	std::array<uint32_t, 4> key = { msg.get<uint32_t>(), msg.get<uint32_t>(), msg.get<uint32_t>(), msg.get<uint32_t>() };
 	enableXTEAEncryption();
@@ -174,8 +222,5 @@ void ProtocolLogin::onRecvFirstMessage(NetworkMessage &msg) {
 		return;
 	}
 
-	g_dispatcher().addEvent([self = std::static_pointer_cast<ProtocolLogin>(shared_from_this()), accountDescriptor, password] {
-		self->getCharacterList(accountDescriptor, password);
-	},
-	                        "ProtocolLogin::getCharacterList");
+	getCharacterList(accountDescriptor, password);
 }
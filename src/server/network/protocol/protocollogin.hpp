@@ -30,9 +30,13 @@ public:
 	void onRecvFirstMessage(NetworkMessage &msg);
 
 private:
+	// Runs on the login worker pool: RSA decryption and password hashing never touch the network or dispatcher threads
+	void processFirstMessage(NetworkMessage &msg);
 	void disconnectClient(const std::string &message);
 
 	void getCharacterList(const std::string &accountDescriptor, const std::string &password);
 
 	bool oldProtocol = false;
+
+	static std::atomic<uint32_t> pendingLogins;
 };
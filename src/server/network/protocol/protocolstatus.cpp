@@ -25,6 +25,15 @@ std::string ProtocolStatus::SERVER_DEVELOPERS = "OpenTibiaBR Organization";
 std::map<uint32_t, int64_t> ProtocolStatus::ipConnectMap;
 const uint64_t ProtocolStatus::start = OTSYS_TIME(true);
 
+std::shared_ptr<const std::string> ProtocolStatus::statusCache;
+std::mutex ProtocolStatus::statusCacheMutex;
+std::atomic<bool> ProtocolStatus::statusCacheDirty = true;
+int64_t ProtocolStatus::statusCacheUpdatedAt = 0;
+
+phmap::flat_hash_map<uint32_t, uint32_t> ProtocolStatus::onlinePlayerIp;
+phmap::flat_hash_map<uint32_t, uint32_t> ProtocolStatus::onlinePerIp;
+uint32_t ProtocolStatus::onlineCount = 0;
+
 void ProtocolStatus::onRecvFirstMessage(NetworkMessage &msg) {
 	uint32_t ip = getIP();
 	if (ip != 0x0100007F) {
@@ -44,10 +53,7 @@ void ProtocolStatus::onRecvFirstMessage(NetworkMessage &msg) {
 		// XML info protocol
 		case 0xFF: {
 			if (msg.getString(4) == "info") {
-				g_dispatcher().addEvent([self = std::static_pointer_cast<ProtocolStatus>(shared_from_this())] {
-					self->sendStatusString();
-				},
-				                        "ProtocolStatus::sendStatusString");
+				sendStatusString();
 				return;
 			}
 			break;
@@ -74,11 +80,7 @@ void ProtocolStatus::onRecvFirstMessage(NetworkMessage &msg) {
 	disconnect();
 }
 
-void ProtocolStatus::sendStatusString() {
-	auto output = OutputMessagePool::getOutputMessage();
-
-	setRawMessages(true);
-
+std::string ProtocolStatus::buildStatusString() {
 	pugi::xml_document doc;
 
 	pugi::xml_node decl = doc.prepend_child(pugi::node_declaration);
@@ -104,23 +106,7 @@ void ProtocolStatus::sendStatusString() {
 	owner.append_attribute("email") = g_configManager().getString(OWNER_EMAIL, __FUNCTION__).c_str();
 
 	pugi::xml_node players = tsqp.append_child("players");
-	uint32_t real = 0;
-	std::map<uint32_t, uint32_t> listIP;
-	for (const auto &[key, player] : g_game().getPlayers()) {
-		if (player->getIP() != 0) {
-			auto ip = listIP.find(player->getIP());
-			if (ip != listIP.end()) {
-				listIP[player->getIP()]++;
-				if (listIP[player->getIP()] < 5) {
-					real++;
-				}
-			} else {
-				listIP[player->getIP()] = 1;
-				real++;
-			}
-		}
-	}
-	players.append_attribute("online") = std::to_string(real).c_str();
+	players.append_attribute("online") = std::to_string(onlineCount).c_str();
 	players.append_attribute("max") = std::to_string(g_configManager().getNumber(MAX_PLAYERS, __FUNCTION__)).c_str();
 	players.append_attribute("peak") = std::to_string(g_game().getPlayersRecord()).c_str();
 
@@ -151,9 +137,72 @@ void ProtocolStatus::sendStatusString() {
 
 	std::ostringstream ss;
 	doc.save(ss, "", pugi::format_raw);
+	return ss.str();
+}
+
+void ProtocolStatus::refreshStatusCache(bool force /* = false*/) {
+	const auto now = OTSYS_TIME();
+	if (!force && !statusCacheDirty && now - statusCacheUpdatedAt < STATUS_CACHE_MAX_AGE_MS) {
+		return;
+	}
+
+	statusCacheDirty = false;
+	statusCacheUpdatedAt = now;
+	auto data = std::make_shared<const std::string>(buildStatusString());
+	std::scoped_lock lock(statusCacheMutex);
+	statusCache = std::move(data);
+}
+
+void ProtocolStatus::addOnlinePlayer(uint32_t playerId, uint32_t ip) {
+	if (ip == 0 || !onlinePlayerIp.try_emplace(playerId, ip).second) {
+		return;
+	}
 
-	std::string data = ss.str();
-	output->addBytes(data.c_str(), data.size());
+	if (++onlinePerIp[ip] <= STATUS_MAX_PLAYERS_PER_IP) {
+		++onlineCount;
+	}
+	statusCacheDirty = true;
+}
+
+void ProtocolStatus::removeOnlinePlayer(uint32_t playerId) {
+	auto playerIt = onlinePlayerIp.find(playerId);
+	if (playerIt == onlinePlayerIp.end()) {
+		return;
+	}
+
+	auto ipIt = onlinePerIp.find(playerIt->second);
+	if (ipIt != onlinePerIp.end()) {
+		if (ipIt->second <= STATUS_MAX_PLAYERS_PER_IP) {
+			--onlineCount;
+		}
+		if (--ipIt->second == 0) {
+			onlinePerIp.erase(ipIt);
+		}
+	}
+	onlinePlayerIp.erase(playerIt);
+	statusCacheDirty = true;
+}
+
+void ProtocolStatus::sendStatusString() {
+	std::shared_ptr<const std::string> data;
+	{
+		std::scoped_lock lock(statusCacheMutex);
+		data = statusCache;
+	}
+
+	if (!data) {
+		// Nothing cached yet (server still starting), build it on the dispatcher once
+		g_dispatcher().addEvent([self = std::static_pointer_cast<ProtocolStatus>(shared_from_this())] {
+			refreshStatusCache(true);
+			self->sendStatusString();
+		},
+		                        "ProtocolStatus::sendStatusString");
+		return;
+	}
+
+	auto output = OutputMessagePool::getOutputMessage();
+	setRawMessages(true);
+	output->addBytes(data->data(), data->size());
 	send(output);
 	disconnect();
 }
@@ -30,6 +30,16 @@ public:
 	void sendStatusString();
 	void sendInfo(uint16_t requestedInfo, const std::string &characterName);
 
+	// Online players per IP are kept incrementally so the status payload never walks the player list
+	static void addOnlinePlayer(uint32_t playerId, uint32_t ip);
+	static void removeOnlinePlayer(uint32_t playerId);
+	/**
+	 * @brief Rebuilds the pre-serialized status payload.
+	 * @details Must run on the dispatcher thread. Skipped when nothing changed
+	 * since the last build, unless the payload is older than STATUS_CACHE_MAX_AGE_MS.
+	 */
+	static void refreshStatusCache(bool force = false);
+
 	static const uint64_t start;
 
 	static std::string SERVER_NAME;
@@ -37,5 +47,16 @@ public:
 	static std::string SERVER_DEVELOPERS;
 
 private:
+	static std::string buildStatusString();
+
 	static std::map<uint32_t, int64_t> ipConnectMap;
+
+	static std::shared_ptr<const std::string> statusCache;
+	static std::mutex statusCacheMutex;
+	static std::atomic<bool> statusCacheDirty;
+	static int64_t statusCacheUpdatedAt;
+
+	static phmap::flat_hash_map<uint32_t, uint32_t> onlinePlayerIp;
+	static phmap::flat_hash_map<uint32_t, uint32_t> onlinePerIp;
+	static uint32_t onlineCount;
 };
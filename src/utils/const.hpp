@@ -14,6 +14,8 @@ static constexpr uint32_t MAX_STATICWALK = 100;
 
 static constexpr size_t NETWORKMESSAGE_PLAYERNAME_MAXLENGTH = 30;
 static constexpr int32_t NETWORKMESSAGE_MAXSIZE = 65500;
+// Upper bound of a single item encoding on a tile description (podiums with outfit and mount are the largest)
+static constexpr int32_t TILE_DESCRIPTION_MAX_ITEM_SIZE = 64;
 
 static constexpr int32_t INPUTMESSAGE_MAXSIZE = 4096;
 
@@ -23,6 +25,13 @@ static constexpr int32_t CHANNEL_PRIVATE = 0xFFFF;
 
 // This is in miliseconds
 static constexpr int32_t EVENT_IMBUEMENT_INTERVAL = 1000;
+static constexpr int32_t EVENT_STATUS_CACHE_INTERVAL = 1000;
+static constexpr int32_t EVENT_CONDITION_REPORT_INTERVAL = 60000;
+static constexpr int32_t EVENT_CALLBACK_REPORT_INTERVAL = 60000;
+static constexpr int32_t STATUS_CACHE_MAX_AGE_MS = 10000;
+static constexpr int64_t PARTY_MEMBER_ACTIVITY_TIMEOUT = 2 * 60 * 1000;
+// Players sharing an IP beyond this amount are not counted as online on the status protocol
+static constexpr uint32_t STATUS_MAX_PLAYERS_PER_IP = 4;
 static constexpr uint8_t IMBUEMENT_MAX_TIER = 3;
 
 static constexpr int32_t STORAGEVALUE_EMOTE = 30008;
@@ -0,0 +1,155 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <parallel_hashmap/phmap.h>
+
+// lru_set is a set that keeps its elements ordered by last access.
+// Nodes live in a single vector and are linked by index (intrusive list),
+// so touch, insert, erase and access to the least recently used element are O(1)
+// and no allocation happens once the set reached its reserved size.
+
+namespace stdext {
+	template <typename T>
+	class lru_set {
+	public:
+		lru_set() = default;
+
+		explicit lru_set(size_t reserveSize) {
+			reserve(reserveSize);
+		}
+
+		void reserve(size_t size) {
+			nodes.reserve(size);
+			index.reserve(size);
+		}
+
+		bool contains(const T &v) const {
+			return index.contains(v);
+		}
+
+		// Marks the element as most recently used, returns false if it isn't in the set
+		bool touch(const T &v) {
+			const auto it = index.find(v);
+			if (it == index.end()) {
+				return false;
+			}
+			unlink(it->second);
+			linkFront(it->second);
+			return true;
+		}
+
+		// Inserts as most recently used, returns false (and touches it) if it was already in the set
+		bool insert(const T &v) {
+			if (touch(v)) {
+				return false;
+			}
+
+			uint32_t slot;
+			if (freeHead != npos) {
+				slot = freeHead;
+				freeHead = nodes[slot].next;
+				nodes[slot].value = v;
+			} else {
+				slot = static_cast<uint32_t>(nodes.size());
+				nodes.emplace_back(Node { v });
+			}
+
+			linkFront(slot);
+			index.emplace(v, slot);
+			return true;
+		}
+
+		bool erase(const T &v) {
+			const auto it = index.find(v);
+			if (it == index.end()) {
+				return false;
+			}
+
+			const uint32_t slot = it->second;
+			index.erase(it);
+			unlink(slot);
+			nodes[slot].next = freeHead;
+			freeHead = slot;
+			return true;
+		}
+
+		// Least recently used element, the set must not be empty
+		const T &back() const {
+			return nodes[tail].value;
+		}
+
+		// Most recently used element, the set must not be empty
+		const T &front() const {
+			return nodes[head].value;
+		}
+
+		void clear() {
+			nodes.clear();
+			index.clear();
+			head = tail = freeHead = npos;
+		}
+
+		size_t size() const {
+			return index.size();
+		}
+
+		bool empty() const {
+			return index.empty();
+		}
+
+	private:
+		static constexpr uint32_t npos = UINT32_MAX;
+
+		struct Node {
+			T value;
+			uint32_t prev = npos;
+			uint32_t next = npos;
+		};
+
+		void unlink(uint32_t slot) {
+			auto &node = nodes[slot];
+			if (node.prev != npos) {
+				nodes[node.prev].next = node.next;
+			} else {
+				head = node.next;
+			}
+
+			if (node.next != npos) {
+				nodes[node.next].prev = node.prev;
+			} else {
+				tail = node.prev;
+			}
+			node.prev = node.next = npos;
+		}
+
+		void linkFront(uint32_t slot) {
+			auto &node = nodes[slot];
+			node.prev = npos;
+			node.next = head;
+			if (head != npos) {
+				nodes[head].prev = slot;
+			}
+			head = slot;
+			if (tail == npos) {
+				tail = slot;
+			}
+		}
+
+		std::vector<Node> nodes;
+		phmap::flat_hash_map<T, uint32_t> index;
+		uint32_t head = npos;
+		uint32_t tail = npos;
+		uint32_t freeHead = npos;
+	};
+}
@@ -0,0 +1,133 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// word_trie maps words to values, ignoring ASCII case.
+// Nodes live in a single vector and children are kept sorted by character,
+// so a lookup walks the input once, without allocating.
+
+namespace stdext {
+	template <typename T>
+	class word_trie {
+	public:
+		word_trie() {
+			clear();
+		}
+
+		// Returns false (and keeps the stored value) if the word is already in the trie
+		bool insert(std::string_view word, T value) {
+			uint32_t node = 0;
+			for (const char c : word) {
+				const char lower = toLower(c);
+				auto &children = nodes[node].children;
+				auto it = std::ranges::lower_bound(children, lower, {}, &Child::first);
+				if (it != children.end() && it->first == lower) {
+					node = it->second;
+					continue;
+				}
+
+				const auto child = static_cast<uint32_t>(nodes.size());
+				children.emplace(it, lower, child);
+				nodes.emplace_back();
+				node = child;
+			}
+
+			if (nodes[node].value != npos) {
+				return false;
+			}
+
+			nodes[node].value = static_cast<uint32_t>(values.size());
+			nodes[node].length = static_cast<uint32_t>(word.size());
+			values.emplace_back(std::move(value));
+			return true;
+		}
+
+		// Value of the longest stored word the text starts with, nullptr if there is none
+		const T* findLongestPrefix(std::string_view text, size_t* length = nullptr) const {
+			const T* found = nullptr;
+			uint32_t node = 0;
+			for (size_t i = 0;; ++i) {
+				if (nodes[node].value != npos) {
+					found = &values[nodes[node].value];
+					if (length) {
+						*length = nodes[node].length;
+					}
+				}
+
+				if (i == text.size()) {
+					break;
+				}
+
+				node = findChild(node, toLower(text[i]));
+				if (node == npos) {
+					break;
+				}
+			}
+			return found;
+		}
+
+		// Value of the stored word equal to the given one, nullptr if there is none
+		const T* find(std::string_view word) const {
+			uint32_t node = 0;
+			for (const char c : word) {
+				node = findChild(node, toLower(c));
+				if (node == npos) {
+					return nullptr;
+				}
+			}
+			return nodes[node].value != npos ? &values[nodes[node].value] : nullptr;
+		}
+
+		void clear() {
+			nodes.clear();
+			nodes.emplace_back();
+			values.clear();
+		}
+
+		size_t size() const {
+			return values.size();
+		}
+
+		bool empty() const {
+			return values.empty();
+		}
+
+	private:
+		static constexpr uint32_t npos = UINT32_MAX;
+
+		using Child = std::pair<char, uint32_t>;
+
+		struct Node {
+			std::vector<Child> children;
+			uint32_t value = npos;
+			uint32_t length = 0;
+		};
+
+		static char toLower(char c) {
+			return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+		}
+
+		uint32_t findChild(uint32_t node, char c) const {
+			const auto &children = nodes[node].children;
+			const auto it = std::ranges::lower_bound(children, c, {}, &Child::first);
+			return it != children.end() && it->first == c ? it->second : npos;
+		}
+
+		std::vector<Node> nodes;
+		std::vector<T> values;
+	};
+}
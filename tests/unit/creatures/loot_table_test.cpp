@@ -0,0 +1,89 @@
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/monsters/loot_table.hpp"
+
+using namespace boost::ut;
+
+suite<"creatures"> lootTableTest = [] {
+	const auto entry = [](uint16_t itemId, uint32_t chance) {
+		CompiledLootEntry lootEntry;
+		lootEntry.itemId = itemId;
+		lootEntry.chance = chance;
+		return lootEntry;
+	};
+
+	test("LootTable drops every entry at full chance") = [&entry] {
+		LootTable table;
+		table.add(entry(3031, MAX_LOOTCHANCE));
+		table.add(entry(3357, MAX_LOOTCHANCE));
+
+		std::mt19937 generator(7);
+		std::vector<LootDrop> drops;
+		table.roll(100.0, 0, drops, generator);
+		expect(eq(drops.size(), 2U));
+		expect(eq(drops[0].itemId, 3031) and eq(drops[0].count, 1U));
+		expect(eq(drops[1].itemId, 3357) and eq(drops[1].count, 1U));
+	};
+
+	test("LootTable adds up repeated items and stops after a unique one") = [&entry] {
+		LootTable table;
+		table.add(entry(3031, MAX_LOOTCHANCE));
+		table.add(entry(3031, MAX_LOOTCHANCE));
+		auto unique = entry(3357, MAX_LOOTCHANCE);
+		unique.unique = true;
+		table.add(unique);
+		table.add(entry(3357, MAX_LOOTCHANCE));
+
+		std::mt19937 generator(7);
+		std::vector<LootDrop> drops;
+		table.roll(100.0, 0, drops, generator);
+		expect(eq(drops.size(), 2U));
+		expect(eq(drops[0].count, 2U));
+		expect(eq(drops[1].count, 1U) and drops[1].entry->unique);
+	};
+
+	test("LootTable keeps stack counts within bounds") = [&entry] {
+		auto gold = entry(3031, MAX_LOOTCHANCE);
+		gold.stackable = true;
+		gold.minCount = 10;
+		gold.countRange = 41;
+		LootTable table;
+		table.add(gold);
+
+		std::mt19937 generator(7);
+		for (int kill = 0; kill < 1000; ++kill) {
+			std::vector<LootDrop> drops;
+			table.roll(100.0, 0, drops, generator);
+			expect(eq(drops.size(), 1U));
+			expect(drops[0].count >= 10U and drops[0].count <= 50U);
+		}
+	};
+
+	test("LootTable drop rate follows chance, loot rate and gut charm") = [&entry] {
+		auto product = entry(5890, MAX_LOOTCHANCE / 10);
+		product.creatureProduct = true;
+		LootTable table;
+		table.add(entry(3031, MAX_LOOTCHANCE / 10));
+		table.add(product);
+
+		constexpr int kills = 200000;
+		const auto dropRate = [&table](double multiplier, uint32_t gutPercent, uint16_t itemId) {
+			std::mt19937 generator(42);
+			std::vector<LootDrop> drops;
+			int dropped = 0;
+			for (int kill = 0; kill < kills; ++kill) {
+				drops.clear();
+				table.roll(multiplier, gutPercent, drops, generator);
+				dropped += std::ranges::count(drops, itemId, &LootDrop::itemId);
+			}
+			return static_cast<double>(dropped) / kills;
+		};
+
+		expect(std::abs(dropRate(100.0, 0, 3031) - 0.10) < 0.005);
+		expect(std::abs(dropRate(200.0, 0, 3031) - 0.20) < 0.005);
+		expect(std::abs(dropRate(100.0, 120, 5890) - 0.12) < 0.005);
+		expect(std::abs(dropRate(100.0, 120, 3031) - 0.10) < 0.005);
+	};
+};
@@ -125,4 +125,18 @@ suite<"kv"> kvTest = [] {
 			  kv.remove("key2");
 			  expect(!kv.get("key2").has_value());
 		  };
+
+	test("Only modified keys are dirty") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		kv.flush();
+		expect(eq(kv.dirtySize(), size_t { 0 }));
+		kv.set("dirty1", 1);
+		kv.set("dirty2", 2);
+		kv.set("dirty1", 3);
+		expect(eq(kv.dirtySize(), size_t { 2 }));
+		expect(!kv.get("not-loaded").has_value());
+		expect(eq(kv.dirtySize(), size_t { 2 }));
+		kv.remove("dirty2");
+		expect(eq(kv.dirtySize(), size_t { 2 }));
+	};
 };
@@ -0,0 +1,44 @@
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "map/utils/sightline.hpp"
+
+using namespace boost::ut;
+
+suite<"map"> sightLineTest = [] {
+	using Cell = std::pair<uint16_t, uint16_t>;
+
+	const auto blockedBy = [](std::set<Cell> walls) {
+		return [walls = std::move(walls)](uint16_t x, uint16_t y) {
+			return walls.contains({ x, y });
+		};
+	};
+
+	test("walkSightLine is clear without walls") = [&blockedBy] {
+		const auto open = blockedBy({});
+		expect(walkSightLine(Position { 100, 100, 7 }, Position { 100, 100, 7 }, open));
+		expect(walkSightLine(Position { 100, 100, 7 }, Position { 107, 100, 7 }, open));
+		expect(walkSightLine(Position { 100, 100, 7 }, Position { 100, 93, 7 }, open));
+		expect(walkSightLine(Position { 100, 100, 7 }, Position { 105, 97, 7 }, open));
+	};
+
+	test("walkSightLine is blocked by a wall in between") = [&blockedBy] {
+		const auto wall = blockedBy({ { 103, 100 }, { 100, 103 }, { 102, 102 } });
+		expect(!walkSightLine(Position { 100, 100, 7 }, Position { 106, 100, 7 }, wall));
+		expect(!walkSightLine(Position { 106, 100, 7 }, Position { 100, 100, 7 }, wall));
+		expect(!walkSightLine(Position { 100, 100, 7 }, Position { 100, 106, 7 }, wall));
+		expect(!walkSightLine(Position { 100, 100, 7 }, Position { 104, 104, 7 }, wall));
+	};
+
+	test("walkSightLine only checks the cells between both ends") = [&blockedBy] {
+		const auto ends = blockedBy({ { 100, 100 }, { 105, 100 } });
+		expect(walkSightLine(Position { 100, 100, 7 }, Position { 105, 100, 7 }, ends));
+	};
+
+	test("walkSightLine passes beside walls that are off the line") = [&blockedBy] {
+		const auto wall = blockedBy({ { 101, 102 } });
+		expect(walkSightLine(Position { 100, 100, 7 }, Position { 101, 103, 7 }, wall));
+		expect(!walkSightLine(Position { 100, 100, 7 }, Position { 101, 103, 7 }, blockedBy({ { 100, 102 } })));
+	};
+};
@@ -0,0 +1,49 @@
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "utils/lru_set.hpp"
+
+using namespace boost::ut;
+
+suite<"utils"> lruSetTest = [] {
+	test("lru_set keeps insertion order as recency") = [] {
+		stdext::lru_set<uint32_t> set(4);
+		expect(set.insert(1));
+		expect(set.insert(2));
+		expect(set.insert(3));
+		expect(!set.insert(2));
+		expect(eq(set.size(), size_t { 3 }));
+		expect(eq(set.back(), uint32_t { 1 }));
+		expect(eq(set.front(), uint32_t { 2 }));
+	};
+
+	test("lru_set touch moves element to the front") = [] {
+		stdext::lru_set<uint32_t> set;
+		set.insert(1);
+		set.insert(2);
+		expect(set.touch(1));
+		expect(!set.touch(3));
+		expect(eq(set.front(), uint32_t { 1 }));
+		expect(eq(set.back(), uint32_t { 2 }));
+	};
+
+	test("lru_set erase reuses slots") = [] {
+		stdext::lru_set<uint32_t> set;
+		set.insert(1);
+		set.insert(2);
+		set.insert(3);
+		expect(set.erase(1));
+		expect(!set.erase(1));
+		expect(!set.contains(1));
+		expect(eq(set.back(), uint32_t { 2 }));
+		set.insert(4);
+		expect(eq(set.front(), uint32_t { 4 }));
+		expect(set.erase(4));
+		expect(set.erase(3));
+		expect(set.erase(2));
+		expect(set.empty());
+		set.insert(5);
+		expect(eq(set.front(), set.back()));
+	};
+};
@@ -0,0 +1,91 @@
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "utils/word_trie.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	// Longest case-insensitive prefix by scanning every word, as Spells::getInstantSpell used to
+	size_t linearLongestPrefix(const std::vector<std::string> &words, const std::string &text) {
+		size_t best = std::string::npos;
+		for (size_t i = 0; i < words.size(); ++i) {
+			const auto &word = words[i];
+			if (word.size() > text.size()) {
+				continue;
+			}
+			const bool match = std::ranges::equal(word, std::string_view(text).substr(0, word.size()), [](char a, char b) {
+				return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+			});
+			if (match && (best == std::string::npos || word.size() > words[best].size())) {
+				best = i;
+			}
+		}
+		return best;
+	}
+}
+
+suite<"utils"> wordTrieTest = [] {
+	test("word_trie finds the longest prefix ignoring case") = [] {
+		stdext::word_trie<int> trie;
+		expect(trie.insert("exura", 1));
+		expect(trie.insert("exura gran", 2));
+		expect(trie.insert("exura vita", 3));
+		expect(!trie.insert("EXURA", 4));
+
+		size_t length = 0;
+		const int* found = trie.findLongestPrefix("Exura Gran", &length);
+		expect(found != nullptr && *found == 2);
+		expect(eq(length, size_t { 10 }));
+
+		found = trie.findLongestPrefix("exura gra", &length);
+		expect(found != nullptr && *found == 1);
+		expect(eq(length, size_t { 5 }));
+
+		expect(trie.findLongestPrefix("exur") == nullptr);
+		expect(trie.findLongestPrefix("") == nullptr);
+		expect(eq(trie.size(), size_t { 3 }));
+	};
+
+	test("word_trie find only matches whole words") = [] {
+		stdext::word_trie<int> trie;
+		trie.insert("utani hur", 1);
+		expect(trie.find("UTANI HUR") != nullptr);
+		expect(trie.find("utani") == nullptr);
+		expect(trie.find("utani hur ") == nullptr);
+		trie.clear();
+		expect(trie.empty());
+		expect(trie.find("utani hur") == nullptr);
+	};
+
+	test("word_trie agrees with a linear scan over a chat log") = [] {
+		const std::vector<std::string> spells {
+			"exura", "exura gran", "exura vita", "exura ico", "exura san", "exura gran san", "exori", "exori gran", "exori min",
+			"exori mas", "exori con", "exevo gran mas vis", "exevo gran mas flam", "exevo vis hur", "exevo flam hur", "exani tera",
+			"exani hur", "utani hur", "utani gran hur", "utamo vita", "utevo lux", "utevo gran lux", "exiva", "adori vita vis",
+			"adevo grav tera", "utito tempo", "utura gran", "exeta res", "exana pox", "exana mort", "exevo pan", "utevo res ina",
+		};
+		const std::vector<std::string> chatLog {
+			"hi", "exura", "Exura Gran", "EXURA VITA", "exura vita pls", "exevo gran mas vis", "exiva \"Knight Name", "exiva",
+			"utani gran hur", "utamo", "hello there", "trade?", "exori", "exori gran", "exori gran ico", "anyone selling bps?",
+			"utevo res ina \"rat", "exani hur \"up", "exani hur \"down", "exevo pan", "u", "ex", "exura sio \"friend", "bye", "",
+			"Utito Tempo", "utura gran", "exeta res", "exana pox", "exana mort", "exevo vis hurr", "lol",
+		};
+
+		stdext::word_trie<size_t> trie;
+		for (size_t i = 0; i < spells.size(); ++i) {
+			trie.insert(spells[i], i);
+		}
+
+		for (const auto &line : chatLog) {
+			const size_t expected = linearLongestPrefix(spells, line);
+			const size_t* found = trie.findLongestPrefix(line);
+			if (expected == std::string::npos) {
+				expect(found == nullptr) << line;
+			} else {
+				expect(found != nullptr && *found == expected) << line;
+			}
+		}
+	};
+};